@@ -5,21 +5,75 @@
 #include "slang/ast/Compilation.h"
 
 #include "netlist/BuilderOptions.hpp"
+#include "netlist/ClockDomainMap.hpp"
+#include "netlist/ConstantDriverMap.hpp"
 #include "netlist/DriverBitRange.hpp"
+#include "netlist/LogicLevels.hpp"
 #include "netlist/NetlistEdge.hpp"
 #include "netlist/NetlistGraph.hpp"
 #include "netlist/NetlistNode.hpp"
 #include "netlist/NetlistPath.hpp"
+#include "netlist/PathEnumerator.hpp"
 #include "netlist/PathFinder.hpp"
+#include "netlist/ReachabilityIndex.hpp"
+#include "netlist/SequentialGraph.hpp"
+#include "netlist/TraversalContext.hpp"
 #include "netlist/VisitAll.hpp"
 
+#include <chrono>
+#include <cstdint>
 #include <ranges>
+#include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 using namespace slang;
 namespace py = pybind11;
 
+namespace {
+
+/// Traversal scratch storage shared by the graph queries made from one
+/// thread, so repeated queries from Python don't reallocate it.
+auto scratchContext() -> netlist::TraversalContext & {
+  thread_local netlist::TraversalContext context;
+  return context;
+}
+
+/// Return @p nodes as a Python list referencing them.
+auto toList(std::span<netlist::NetlistNode *const> nodes) -> py::list {
+  py::list result;
+  for (auto *node : nodes) {
+    result.append(py::cast(node, py::return_value_policy::reference));
+  }
+  return result;
+}
+
+/// Return @p sources as a Python list of (source_node, edge_kind) tuples.
+auto toSensitivityList(
+    std::span<netlist::NetlistGraph::SensitivitySource const> sources)
+    -> py::list {
+  py::list result;
+  for (auto const &s : sources) {
+    result.append(py::make_tuple(
+        py::cast(s.source, py::return_value_policy::reference), s.edgeKind));
+  }
+  return result;
+}
+
+/// Return @p nodes as a Python list of (node, bit ranges) tuples.
+auto toBitList(std::span<netlist::NetlistGraph::BitNode const> nodes)
+    -> py::list {
+  py::list result;
+  for (auto const &n : nodes) {
+    result.append(py::make_tuple(
+        py::cast(n.node, py::return_value_policy::reference), n.bits));
+  }
+  return result;
+}
+
+} // namespace
+
 PYBIND11_MODULE(pyslang_netlist, m) {
   m.doc() = "Slang netlist";
 
@@ -109,12 +163,14 @@ PYBIND11_MODULE(pyslang_netlist, m) {
           [](netlist::NetlistGraph &self, ast::Compilation &compilation,
              analysis::AnalysisManager &analysisManager, bool parallel,
              unsigned numThreads, bool resolveAssignBits,
-             bool propCutsAcrossPorts, std::vector<std::string> blackBoxes) {
+             bool propCutsAcrossPorts, std::vector<std::string> blackBoxes,
+             bool simplify) {
             netlist::BuilderOptions const opts{
                 .resolveAssignBits = resolveAssignBits,
                 .propCutsAcrossPorts = propCutsAcrossPorts,
                 .parallel = parallel,
                 .numThreads = numThreads,
+                .simplify = simplify,
                 .blackBoxes = std::move(blackBoxes)};
             self.build(compilation, analysisManager, opts);
           },
@@ -123,6 +179,7 @@ PYBIND11_MODULE(pyslang_netlist, m) {
           py::arg("resolve_assign_bits") = true,
           py::arg("prop_cuts_across_ports") = true,
           py::arg("black_boxes") = std::vector<std::string>{},
+          py::arg("simplify") = false,
           "Build the netlist graph from an elaborated compilation. The "
           "caller is responsible for the full setup pipeline first: "
           "(1) run `VisitAll` to force lazy AST construction, "
@@ -140,7 +197,33 @@ PYBIND11_MODULE(pyslang_netlist, m) {
           "instances skip body traversal and record only port-boundary "
           "connectivity. Patterns support `*` (within a path segment), "
           "`**` or `...` (recursive across `.`), and `?` (single char "
-          "within a segment).")
+          "within a segment). "
+          "Set `simplify=True` to contract pass-through nodes once the graph "
+          "is built (see `contract_pass_through_nodes`).")
+      .def("contract_pass_through_nodes",
+           &netlist::NetlistGraph::contractPassThroughNodes,
+           "Contract pass-through Assignment, Merge and single-input "
+           "Conditional nodes, connecting their sources directly to their "
+           "targets while preserving edge annotations. Returns the number of "
+           "nodes removed.")
+      .def("freeze", &netlist::NetlistGraph::freeze,
+           py::arg("release_edges") = false,
+           "Compact the graph into a read-only snapshot that speeds up "
+           "fan-in, fan-out, driver and sensitivity queries. The snapshot is "
+           "dropped when the graph is rebuilt or by `unfreeze()`. "
+           "Set `release_edges=True` to also destroy the graph's own edges, "
+           "keeping them only in the snapshot until `unfreeze()` rebuilds "
+           "them; until then, only the snapshot's queries may be used.")
+      .def("unfreeze", &netlist::NetlistGraph::unfreeze,
+           "Drop the snapshot created by `freeze()`, rebuilding the edges if "
+           "they were released.")
+      .def("is_frozen", &netlist::NetlistGraph::isFrozen,
+           "Return True if the graph has a current frozen snapshot.")
+      .def("has_released_edges", &netlist::NetlistGraph::hasReleasedEdges,
+           "Return True if the graph is frozen with its edges released.")
+      .def("build_indexes", &netlist::NetlistGraph::buildIndexes,
+           "Build the name, hierarchy and (if frozen) driver indexes that "
+           "lookups otherwise build on first use.")
       .def(
           "get_drivers",
           [](const netlist::NetlistGraph &self, std::string_view name,
@@ -155,11 +238,18 @@ PYBIND11_MODULE(pyslang_netlist, m) {
           },
           py::arg("name"), py::arg("lower"), py::arg("upper"),
           "Return driver nodes for the symbol over the given bit range.")
+      .def("get_sequential_graph",
+           &netlist::NetlistGraph::getSequentialGraph,
+           py::return_value_policy::reference_internal,
+           "Return the register-to-register abstraction of the graph: its "
+           "State nodes and top-level ports, with an edge wherever one "
+           "reaches another through combinational logic. Built once on "
+           "first use.")
       .def(
           "get_comb_fan_out",
           [](const netlist::NetlistGraph &self, netlist::NetlistNode &node) {
             py::list result;
-            for (auto *n : self.getCombFanOut(node)) {
+            for (auto *n : self.getCombFanOut(node, scratchContext())) {
               result.append(py::cast(n, py::return_value_policy::reference));
             }
             return result;
@@ -171,7 +261,7 @@ PYBIND11_MODULE(pyslang_netlist, m) {
           "get_comb_fan_in",
           [](const netlist::NetlistGraph &self, netlist::NetlistNode &node) {
             py::list result;
-            for (auto *n : self.getCombFanIn(node)) {
+            for (auto *n : self.getCombFanIn(node, scratchContext())) {
               result.append(py::cast(n, py::return_value_policy::reference));
             }
             return result;
@@ -179,6 +269,75 @@ PYBIND11_MODULE(pyslang_netlist, m) {
           py::arg("node"),
           "Return all nodes that can reach this node via combinational "
           "edges in the backward direction. Stops at State nodes.")
+      .def(
+          "get_comb_fan_out_bits",
+          [](const netlist::NetlistGraph &self, netlist::NetlistNode &node,
+             int32_t lower, int32_t upper) {
+            auto const bits = netlist::DriverBitRange(lower, upper);
+            return toBitList(self.getCombFanOut(node, bits));
+          },
+          py::arg("node"), py::arg("lower"), py::arg("upper"),
+          "Return the combinational fan-out of bits `lower` to `upper` of "
+          "the node, following only edges that carry some of the bits "
+          "reached, as a list of (node, bit ranges) pairs. Operation nodes "
+          "have no bit ranges.")
+      .def(
+          "get_comb_fan_in_bits",
+          [](const netlist::NetlistGraph &self, netlist::NetlistNode &node,
+             int32_t lower, int32_t upper) {
+            auto const bits = netlist::DriverBitRange(lower, upper);
+            return toBitList(self.getCombFanIn(node, bits));
+          },
+          py::arg("node"), py::arg("lower"), py::arg("upper"),
+          "Return the combinational fan-in of bits `lower` to `upper` of the "
+          "node, following only edges that carry some of the bits reached, "
+          "as a list of (node, bit ranges) pairs.")
+      .def(
+          "get_comb_fan_out_many",
+          [](const netlist::NetlistGraph &self,
+             std::vector<netlist::NetlistNode *> const &sources) {
+            py::list result;
+            for (auto const &cone : self.getCombFanOutMany(sources)) {
+              result.append(toList(cone));
+            }
+            return result;
+          },
+          py::arg("sources"),
+          "Return the combinational fan-out of each of the given nodes, as "
+          "a list of node lists in graph order, computing all of them in "
+          "shared sweeps rather than one traversal per node.")
+      .def(
+          "get_comb_fan_in_many",
+          [](const netlist::NetlistGraph &self,
+             std::vector<netlist::NetlistNode *> const &sources) {
+            py::list result;
+            for (auto const &cone : self.getCombFanInMany(sources)) {
+              result.append(toList(cone));
+            }
+            return result;
+          },
+          py::arg("sources"),
+          "Return the combinational fan-in of each of the given nodes, as "
+          "a list of node lists in graph order, computing all of them in "
+          "shared sweeps rather than one traversal per node.")
+      .def(
+          "get_comb_fan_out_counts",
+          [](const netlist::NetlistGraph &self,
+             std::vector<netlist::NetlistNode *> const &sources) {
+            return self.getCombFanOutCounts(sources);
+          },
+          py::arg("sources"),
+          "Return the size of the combinational fan-out of each of the "
+          "given nodes.")
+      .def(
+          "get_comb_fan_in_counts",
+          [](const netlist::NetlistGraph &self,
+             std::vector<netlist::NetlistNode *> const &sources) {
+            return self.getCombFanInCounts(sources);
+          },
+          py::arg("sources"),
+          "Return the size of the combinational fan-in of each of the given "
+          "nodes.")
       .def(
           "find_nodes",
           [](const netlist::NetlistGraph &self, std::string_view pattern) {
@@ -192,6 +351,18 @@ PYBIND11_MODULE(pyslang_netlist, m) {
           "Find named nodes matching a glob pattern. Supports `*` "
           "(within a path segment), `**` or `...` (recursive across "
           "`.`), and `?` (single char within a segment).")
+      .def(
+          "find_nodes_in_scope",
+          [](const netlist::NetlistGraph &self, std::string_view scope) {
+            py::list result;
+            for (auto *n : self.findNodesInScope(scope)) {
+              result.append(py::cast(n, py::return_value_policy::reference));
+            }
+            return result;
+          },
+          py::arg("scope"),
+          "Find named nodes whose hierarchical path is the given scope or "
+          "lies below it.")
       .def(
           "find_nodes_regex",
           [](const netlist::NetlistGraph &self, std::string_view pattern) {
@@ -205,13 +376,8 @@ PYBIND11_MODULE(pyslang_netlist, m) {
       .def(
           "get_sensitivity",
           [](const netlist::NetlistGraph &self, netlist::NetlistNode &node) {
-            py::list result;
-            for (auto const &s : self.getSensitivity(node)) {
-              result.append(py::make_tuple(
-                  py::cast(s.source, py::return_value_policy::reference),
-                  s.edgeKind));
-            }
-            return result;
+            return toSensitivityList(
+                self.getSensitivity(node, scratchContext()));
           },
           py::arg("node"),
           "Return the clocks gating the given node as a list of "
@@ -223,7 +389,7 @@ PYBIND11_MODULE(pyslang_netlist, m) {
           "get_constant_drivers",
           [](const netlist::NetlistGraph &self, netlist::NetlistNode &node) {
             py::list result;
-            for (auto *n : self.getConstantDrivers(node)) {
+            for (auto *n : self.getConstantDrivers(node, scratchContext())) {
               result.append(py::cast(n, py::return_value_policy::reference));
             }
             return result;
@@ -254,10 +420,13 @@ PYBIND11_MODULE(pyslang_netlist, m) {
 
   py::class_<netlist::Port, netlist::NetlistNode>(m, "Port")
       .def_property_readonly(
-          "name", [](netlist::Port const &self) { return self.name; })
+          "name",
+          [](netlist::Port const &self) { return self.symbol->name; })
       .def_property_readonly(
           "path",
-          [](netlist::Port const &self) { return self.hierarchicalPath; })
+          [](netlist::Port const &self) {
+            return self.symbol->getHierarchicalPath();
+          })
       .def_property_readonly(
           "direction", [](netlist::Port const &self) { return self.direction; })
       .def_property_readonly(
@@ -269,19 +438,25 @@ PYBIND11_MODULE(pyslang_netlist, m) {
 
   py::class_<netlist::Variable, netlist::NetlistNode>(m, "Variable")
       .def_property_readonly(
-          "name", [](netlist::Variable const &self) { return self.name; })
+          "name",
+          [](netlist::Variable const &self) { return self.symbol->name; })
       .def_property_readonly(
           "path",
-          [](netlist::Variable const &self) { return self.hierarchicalPath; })
+          [](netlist::Variable const &self) {
+            return self.symbol->getHierarchicalPath();
+          })
       .def_property_readonly(
           "bounds", [](netlist::Variable const &self) { return self.bounds; });
 
   py::class_<netlist::State, netlist::NetlistNode>(m, "State")
       .def_property_readonly(
-          "name", [](netlist::State const &self) { return self.name; })
+          "name",
+          [](netlist::State const &self) { return self.symbol->name; })
       .def_property_readonly(
           "path",
-          [](netlist::State const &self) { return self.hierarchicalPath; })
+          [](netlist::State const &self) {
+            return self.symbol->getHierarchicalPath();
+          })
       .def_property_readonly(
           "bounds", [](netlist::State const &self) { return self.bounds; });
 
@@ -304,13 +479,14 @@ PYBIND11_MODULE(pyslang_netlist, m) {
       .def(py::init<netlist::NetlistNode &, netlist::NetlistNode &>())
       .def_property_readonly("symbol_name",
                              [](const netlist::NetlistEdge &self) {
-                               return self.symbol != nullptr ? self.symbol->name
-                                                             : std::string{};
+                               return self.symbol != nullptr
+                                          ? self.symbol->name
+                                          : std::string_view{};
                              })
       .def_property_readonly("symbol_path",
                              [](const netlist::NetlistEdge &self) {
                                return self.symbol != nullptr
-                                          ? self.symbol->hierarchicalPath
+                                          ? self.symbol->getHierarchicalPath()
                                           : std::string{};
                              })
       .def_property_readonly(
@@ -341,8 +517,19 @@ PYBIND11_MODULE(pyslang_netlist, m) {
           },
           py::keep_alive<0, 1>());
 
-  py::class_<netlist::PathFinder>(m, "PathFinder")
-      .def(py::init<>())
+  py::class_<netlist::PathFinder> pathFinder(m, "PathFinder");
+  py::enum_<netlist::PathFinder::Mode>(pathFinder, "Mode")
+      .value("DepthFirst", netlist::PathFinder::Mode::DepthFirst)
+      .value("Shortest", netlist::PathFinder::Mode::Shortest)
+      .value("Bidirectional", netlist::PathFinder::Mode::Bidirectional);
+  pathFinder.def(py::init<>())
+      .def(py::init<netlist::PathFinder::Mode>(), py::arg("mode"),
+           "Create a path finder that searches in `mode`: DepthFirst returns "
+           "the first path found, Shortest and Bidirectional a path with the "
+           "fewest edges.")
+      .def_property("mode", &netlist::PathFinder::getMode,
+                    &netlist::PathFinder::setMode,
+                    "The search mode of later queries.")
       .def("find", &netlist::PathFinder::find, py::arg("start_node"),
            py::arg("end_node"),
            "Find a path between two nodes in the netlist and return a "
@@ -351,5 +538,250 @@ PYBIND11_MODULE(pyslang_netlist, m) {
            py::arg("end_node"),
            "Find a combinatorial path between two nodes that does not pass "
            "through State nodes. Return an empty NetlistPath if no "
-           "combinatorial path exists.");
+           "combinatorial path exists.")
+      .def(
+          "find_bits",
+          [](netlist::PathFinder &self, netlist::NetlistNode &startNode,
+             int32_t lower, int32_t upper, netlist::NetlistNode &endNode) {
+            return self.find(startNode, netlist::DriverBitRange(lower, upper),
+                             endNode);
+          },
+          py::arg("start_node"), py::arg("lower"), py::arg("upper"),
+          py::arg("end_node"),
+          "Find a path from bits `lower` to `upper` of `start_node` to "
+          "`end_node` along which every edge carries some of the bits "
+          "reached.")
+      .def(
+          "find_comb_bits",
+          [](netlist::PathFinder &self, netlist::NetlistNode &startNode,
+             int32_t lower, int32_t upper, netlist::NetlistNode &endNode) {
+            return self.findComb(startNode,
+                                 netlist::DriverBitRange(lower, upper),
+                                 endNode);
+          },
+          py::arg("start_node"), py::arg("lower"), py::arg("upper"),
+          py::arg("end_node"),
+          "As find_bits, for a path that does not pass through State "
+          "nodes.");
+
+  py::class_<netlist::PathEnumerator> pathEnumerator(m, "PathEnumerator");
+  py::enum_<netlist::PathEnumerator::Status>(pathEnumerator, "Status")
+      .value("Running", netlist::PathEnumerator::Status::Running)
+      .value("Exhausted", netlist::PathEnumerator::Status::Exhausted)
+      .value("PathLimit", netlist::PathEnumerator::Status::PathLimit)
+      .value("TimeLimit", netlist::PathEnumerator::Status::TimeLimit);
+  pathEnumerator
+      .def(py::init([](netlist::NetlistNode &startNode,
+                       netlist::NetlistNode &endNode, size_t maxPaths,
+                       size_t maxDepth, int64_t timeLimitMs,
+                       bool combinational) {
+             return netlist::PathEnumerator(
+                 startNode, endNode,
+                 netlist::PathLimits{maxPaths, maxDepth,
+                                     std::chrono::milliseconds(timeLimitMs)},
+                 combinational);
+           }),
+           py::arg("start_node"), py::arg("end_node"), py::arg("max_paths") = 0,
+           py::arg("max_depth") = 0, py::arg("time_limit_ms") = 0,
+           py::arg("combinational") = false, py::keep_alive<1, 2>(),
+           py::keep_alive<1, 3>(),
+           "Enumerate the simple paths from `start_node` to `end_node`, "
+           "nearest first at each step. At most `max_paths` paths of at most "
+           "`max_depth` edges are produced, within `time_limit_ms` "
+           "milliseconds; zero means no limit. With `combinational`, paths "
+           "do not pass through State nodes. Paths are found as they are "
+           "iterated.")
+      .def("__iter__", [](py::object self) { return self; })
+      .def("__next__",
+           [](netlist::PathEnumerator &self) {
+             auto path = self.next();
+             if (!path) {
+               throw py::stop_iteration();
+             }
+             return std::move(*path);
+           })
+      .def_property_readonly("status", &netlist::PathEnumerator::getStatus,
+                             "Whether more paths may follow, or why the "
+                             "enumeration stopped.")
+      .def("num_paths", &netlist::PathEnumerator::numPaths,
+           "Return the number of paths produced so far.");
+
+  py::class_<netlist::SequentialGraph>(m, "SequentialGraph")
+      .def("num_nodes", &netlist::SequentialGraph::numNodes,
+           "Get the number of nodes in the graph.")
+      .def("num_edges", &netlist::SequentialGraph::numEdges,
+           "Get the number of edges in the graph.")
+      .def(
+          "nodes",
+          [](netlist::SequentialGraph const &self) {
+            py::list result;
+            for (uint32_t i = 0; i < self.numNodes(); i++) {
+              result.append(py::cast(&self.getNode(i),
+                                     py::return_value_policy::reference));
+            }
+            return result;
+          },
+          "Return the State and top-level Port nodes of the graph.")
+      .def(
+          "successors",
+          [](netlist::SequentialGraph const &self,
+             netlist::NetlistNode const &node) {
+            py::list result;
+            auto index = self.getIndex(node);
+            if (index == netlist::SequentialGraph::null_index) {
+              return result;
+            }
+            for (auto next : self.successors(index)) {
+              result.append(py::cast(&self.getNode(next),
+                                     py::return_value_policy::reference));
+            }
+            return result;
+          },
+          py::arg("node"),
+          "Return the nodes that `node` reaches through combinational "
+          "logic, or an empty list if it is not a node of the graph.")
+      .def(
+          "predecessors",
+          [](netlist::SequentialGraph const &self,
+             netlist::NetlistNode const &node) {
+            py::list result;
+            auto index = self.getIndex(node);
+            if (index == netlist::SequentialGraph::null_index) {
+              return result;
+            }
+            for (auto prev : self.predecessors(index)) {
+              result.append(py::cast(&self.getNode(prev),
+                                     py::return_value_policy::reference));
+            }
+            return result;
+          },
+          py::arg("node"),
+          "Return the nodes that reach `node` through combinational logic, "
+          "or an empty list if it is not a node of the graph.");
+
+  py::class_<netlist::ReachabilityIndex>(m, "ReachabilityIndex")
+      .def(py::init<netlist::NetlistGraph const &>(), py::arg("graph"),
+           py::keep_alive<1, 2>(),
+           "Index the combinational reachability of the graph, so that "
+           "`reaches` answers without searching it. The index must be "
+           "rebuilt if the graph changes.")
+      .def(
+          "reaches",
+          [](netlist::ReachabilityIndex const &self,
+             netlist::NetlistNode const &from, netlist::NetlistNode const &to) {
+            return self.reaches(from, to, scratchContext());
+          },
+          py::arg("from_node"), py::arg("to_node"),
+          "Return True if `from_node` reaches `to_node` through "
+          "combinational edges. A node reaches itself.")
+      .def(
+          "find_path",
+          [](netlist::ReachabilityIndex const &self, netlist::NetlistNode &from,
+             netlist::NetlistNode &to) {
+            return self.findPath(from, to, scratchContext());
+          },
+          py::arg("from_node"), py::arg("to_node"),
+          "Return a combinational path from `from_node` to `to_node`, or an "
+          "empty NetlistPath if there is none.")
+      .def("num_components", &netlist::ReachabilityIndex::numComponents,
+           "Return the number of strongly connected components of the "
+           "combinational graph.");
+
+  py::class_<netlist::ClockDomainMap>(m, "ClockDomainMap")
+      .def(py::init<netlist::NetlistGraph const &>(), py::arg("graph"),
+           py::keep_alive<1, 2>(),
+           "Compute the clock domain of every node of the graph in one pass. "
+           "The map must be rebuilt if the graph changes.")
+      .def("num_domains", &netlist::ClockDomainMap::numDomains,
+           "Return the number of distinct domains, including the empty "
+           "domain 0.")
+      .def("get_domain", &netlist::ClockDomainMap::getDomain, py::arg("node"),
+           "Return the index of the domain of `node`. Nodes gated by the "
+           "same set of clocks have the same index.")
+      .def(
+          "get_sources",
+          [](netlist::ClockDomainMap const &self, uint32_t domain) {
+            if (domain >= self.numDomains()) {
+              throw py::index_error("domain index out of range");
+            }
+            return toSensitivityList(self.getSources(domain));
+          },
+          py::arg("domain"),
+          "Return the (source_node, edge_kind) tuples of a domain.")
+      .def(
+          "get_sensitivity",
+          [](netlist::ClockDomainMap const &self,
+             netlist::NetlistNode const &node) {
+            return toSensitivityList(self.getSensitivity(node));
+          },
+          py::arg("node"),
+          "Return the clocks gating `node` as a list of (source_node, "
+          "edge_kind) tuples: the same set as "
+          "`NetlistGraph.get_sensitivity`, looked up without a search.");
+
+  py::class_<netlist::ConstantDriverMap> constantDriverMap(
+      m, "ConstantDriverMap");
+  py::enum_<netlist::ConstantDriverMap::DriveKind>(constantDriverMap,
+                                                   "DriveKind")
+      .value("None", netlist::ConstantDriverMap::DriveKind::None)
+      .value("Constant", netlist::ConstantDriverMap::DriveKind::Constant)
+      .value("State", netlist::ConstantDriverMap::DriveKind::State)
+      .value("External", netlist::ConstantDriverMap::DriveKind::External);
+  constantDriverMap
+      .def(py::init<netlist::NetlistGraph const &>(), py::arg("graph"),
+           py::keep_alive<1, 2>(),
+           "Classify the combinational fan-in of every node of the graph in "
+           "one pass. The map must be rebuilt if the graph changes.")
+      .def("get_drive_kind", &netlist::ConstantDriverMap::getDriveKind,
+           py::arg("node"),
+           "Return what the fan-in of `node` depends on: only Constants, a "
+           "State node, an undriven top-level input, or none of these.")
+      .def(
+          "get_constants",
+          [](netlist::ConstantDriverMap const &self,
+             netlist::NetlistNode const &node) {
+            return toList(self.getConstants(node));
+          },
+          py::arg("node"),
+          "Return every Constant node in the fan-in of `node`.")
+      .def(
+          "get_constant_drivers",
+          [](netlist::ConstantDriverMap const &self,
+             netlist::NetlistNode const &node) {
+            return toList(self.getConstantDrivers(node));
+          },
+          py::arg("node"),
+          "Return the Constant nodes feeding `node` if its fan-in contains "
+          "only Constants, and otherwise an empty list: the same set as "
+          "`NetlistGraph.get_constant_drivers`.")
+      .def("num_constant_sets", &netlist::ConstantDriverMap::numConstantSets,
+           "Return the number of distinct sets of Constant nodes, including "
+           "the empty set.");
+
+  py::class_<netlist::LogicLevels>(m, "LogicLevels")
+      .def(py::init<netlist::NetlistGraph const &>(), py::arg("graph"),
+           py::keep_alive<1, 2>(),
+           "Compute the combinational logic level of every node of the graph "
+           "in one pass. The levels must be rebuilt if the graph changes.")
+      .def("get_level", &netlist::LogicLevels::getLevel, py::arg("node"),
+           "Return the greatest number of logic nodes on a combinational "
+           "path ending at `node`, counting the node itself.")
+      .def("get_depth", &netlist::LogicLevels::getDepth, py::arg("node"),
+           "Return the depth of the logic in front of `node`: the greatest "
+           "level of a node driving it by a data edge if it is a State node, "
+           "and otherwise its level.")
+      .def("max_level", &netlist::LogicLevels::maxLevel,
+           "Return the greatest level of any node.")
+      .def("num_frontiers", &netlist::LogicLevels::numFrontiers,
+           "Return the number of frontiers the topological sort took.")
+      .def(
+          "get_endpoints_by_depth",
+          [](netlist::LogicLevels const &self) {
+            return toList(self.getEndpointsByDepth());
+          },
+          "Return the State nodes and top-level ports, deepest first.")
+      .def("get_deepest_path", &netlist::LogicLevels::getDeepestPath,
+           py::arg("node"),
+           "Return a NetlistPath ending at `node` through as many logic "
+           "nodes as its depth.");
 }
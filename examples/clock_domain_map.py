@@ -12,8 +12,9 @@ originate. Catches mistakes like an instance accidentally clocked on a
 data signal, or a "single clock" design that's silently picked up two
 domains because of a stray ``always @(*)`` or a typo.
 
-Uses ``NetlistGraph.get_sensitivity(state_node)``, which returns the
-deduplicated set of clocked in-edges on a ``State`` node as a list of
+Uses ``ClockDomainMap``, which labels every node of the graph with its
+clock domain in one pass. For a ``State`` node, ``get_sensitivity``
+returns the deduplicated set of its clocked in-edges as a list of
 ``(source_node, edge_kind)`` tuples. ``edge_kind`` is a
 ``pyslang.ast.EdgeKind``.
 """
@@ -48,11 +49,12 @@ def clock_domain_map(graph):
     ``("<unclocked>", "None")`` — typically a latch or a graph fragment
     where the sensitivity didn't survive elaboration.
     """
+    domain_map = pyslang_netlist.ClockDomainMap(graph)
     domains: dict[tuple[str, str], list[str]] = defaultdict(list)
     for node in graph:
         if node.kind != pyslang_netlist.NodeKind.State:
             continue
-        sensitivity = graph.get_sensitivity(node)
+        sensitivity = domain_map.get_sensitivity(node)
         if not sensitivity:
             domains[("<unclocked>", "None")].append(node.path)
             continue
@@ -15,9 +15,11 @@ survives that simplification appear in the result. A chained tie like
 ``logic w; assign w = 1'b0; assign y = w;`` still resolves correctly —
 the fan-in of ``y`` reaches the constant through the elided ``w``.
 
-Uses ``NetlistGraph.get_constant_drivers(sink)``, which returns the
-``Constant`` nodes feeding the sink if its combinational fan-in bottoms
-out only at Constants — empty otherwise. The C++ side handles the
+Uses ``ConstantDriverMap``, which classifies the combinational fan-in of
+every node in one pass. Its ``get_constant_drivers(sink)`` returns the
+``Constant`` nodes feeding the sink if its fan-in bottoms out only at
+Constants — empty otherwise — the same as
+``NetlistGraph.get_constant_drivers``. The C++ side handles the
 classification rule (Constants only, no ``State``, no undriven top-level
 input ``Port``).
 
@@ -42,6 +44,7 @@ def find_constant_driven_sinks(graph):
     Result: ``[(sink_path, [constant_value, ...]), ...]`` sorted by path.
     The constant values are deduplicated and sorted for stable output.
     """
+    constant_drivers = pyslang_netlist.ConstantDriverMap(graph)
     seen_paths = defaultdict(set)
     for node in graph:
         if node.kind == pyslang_netlist.NodeKind.Variable:
@@ -51,7 +54,7 @@ def find_constant_driven_sinks(graph):
         else:
             continue
 
-        constants = graph.get_constant_drivers(node)
+        constants = constant_drivers.get_constant_drivers(node)
         if not constants:
             continue
 
@@ -1,6 +1,13 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <string>
 #include <string_view>
+#include <vector>
 
 namespace slang::netlist {
 
@@ -154,6 +161,216 @@ inline auto wildcardMatch(const char *text, const char *pattern) -> bool {
   return *text == '\0';
 }
 
+/// A set of glob patterns, with the syntax of wildcardMatch, compiled once
+/// into a single nondeterministic automaton.
+///
+/// Matching a subject runs every pattern at once in one pass over its
+/// characters, tracking the live automaton states in a bit set, instead of
+/// reinterpreting each pattern (and backtracking) for every subject. The
+/// subject need not be null-terminated, so callers can match views without
+/// copying them. A set is immutable once built and may be shared between
+/// threads.
+class WildcardSet {
+public:
+  WildcardSet() = default;
+
+  /// Compile each of @p patterns into the set.
+  explicit WildcardSet(std::span<std::string const> patterns) {
+    for (auto const &pattern : patterns) {
+      add(pattern);
+    }
+  }
+
+  /// Compile @p pattern into the set.
+  void add(std::string_view pattern) {
+    auto const start = static_cast<uint32_t>(states.size());
+    size_t pos = 0;
+    while (pos < pattern.size()) {
+      // A recursive wildcard, optionally preceded and followed by a `.`
+      // that it absorbs as an optional segment boundary, as in
+      // wildcardMatch.
+      bool lead = false;
+      auto token = pos;
+      if (pattern[token] == '.' && recursiveLength(pattern, token + 1) != 0) {
+        lead = true;
+        token++;
+      }
+      if (auto length = recursiveLength(pattern, token); length != 0) {
+        auto after = token + length;
+        bool trail = after < pattern.size() && pattern[after] == '.';
+        addRecursive(lead, trail);
+        pos = trail ? after + 1 : after;
+        continue;
+      }
+      auto const self = static_cast<uint32_t>(states.size());
+      if (pattern[pos] == '*') {
+        states.push_back({{{Label::NotDot, 0, self}}, self + 1});
+      } else if (pattern[pos] == '?') {
+        states.push_back({{{Label::NotDot, 0, self + 1}}, none});
+      } else {
+        states.push_back({{{Label::Char, pattern[pos], self + 1}}, none});
+      }
+      pos++;
+    }
+    // The accepting state of the pattern.
+    auto const accept = static_cast<uint32_t>(states.size());
+    states.push_back({});
+
+    auto const numWords = (states.size() + 63) / 64;
+    initial.resize(numWords, 0);
+    accepting.resize(numWords, 0);
+    accepting[accept / 64] |= uint64_t{1} << (accept % 64);
+    enter(initial, start);
+    numPatterns++;
+  }
+
+  /// Return true if @p text matches at least one pattern in the set.
+  [[nodiscard]] auto matches(std::string_view text) const -> bool {
+    if (numPatterns == 0) {
+      return false;
+    }
+    auto const numWords = initial.size();
+    // Two bit sets of live states, on the stack for small sets.
+    std::array<uint64_t, 8> local;
+    std::vector<uint64_t> heap;
+    uint64_t *storage = local.data();
+    if (2 * numWords > local.size()) {
+      heap.resize(2 * numWords);
+      storage = heap.data();
+    }
+    std::span<uint64_t> current(storage, numWords);
+    std::span<uint64_t> next(storage + numWords, numWords);
+    std::ranges::copy(initial, current.begin());
+
+    for (auto ch : text) {
+      std::ranges::fill(next, 0);
+      bool live = false;
+      for (size_t word = 0; word < numWords; word++) {
+        for (auto bits = current[word]; bits != 0; bits &= bits - 1) {
+          auto const &state =
+              states[word * 64 + static_cast<size_t>(std::countr_zero(bits))];
+          for (auto const &edge : state.edges) {
+            if (edge.accepts(ch)) {
+              enter(next, edge.target);
+              live = true;
+            }
+          }
+        }
+      }
+      if (!live) {
+        return false;
+      }
+      std::swap(current, next);
+    }
+    for (size_t word = 0; word < numWords; word++) {
+      if ((current[word] & accepting[word]) != 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Return true if the set has no patterns, and so matches nothing.
+  [[nodiscard]] auto empty() const -> bool { return numPatterns == 0; }
+
+  /// Return the number of patterns in the set.
+  [[nodiscard]] auto size() const -> size_t { return numPatterns; }
+
+private:
+  static constexpr uint32_t none = UINT32_MAX;
+
+  enum class Label : uint8_t { None, Char, NotDot, Any };
+
+  struct Edge {
+    Label label = Label::None;
+    char ch = 0;
+    uint32_t target = none;
+
+    [[nodiscard]] auto accepts(char c) const -> bool {
+      switch (label) {
+      case Label::None:
+        return false;
+      case Label::Char:
+        return c == ch;
+      case Label::NotDot:
+        return c != '.';
+      case Label::Any:
+        return true;
+      }
+      return false;
+    }
+  };
+
+  /// A state has at most two labelled edges and one epsilon edge, and
+  /// epsilon edges only lead forward, so the closure of a state is a chain.
+  struct State {
+    std::array<Edge, 2> edges;
+    uint32_t epsilon = none;
+  };
+
+  /// Return the length of the recursive wildcard (`**` or `...`) at @p pos
+  /// of @p pattern, or 0 if there is none.
+  static auto recursiveLength(std::string_view pattern, size_t pos)
+      -> size_t {
+    auto rest = pattern.substr(std::min(pos, pattern.size()));
+    if (rest.starts_with("**")) {
+      return 2;
+    }
+    if (rest.starts_with("...")) {
+      return 3;
+    }
+    return 0;
+  }
+
+  /// Add the states of a recursive wildcard. With neither @p lead nor
+  /// @p trail it matches any characters; with only @p trail, nothing or
+  /// any characters ending in `.`; with only @p lead, nothing or `.`
+  /// followed by any characters; with both, `.` optionally followed by
+  /// any characters ending in `.`.
+  void addRecursive(bool lead, bool trail) {
+    auto const self = static_cast<uint32_t>(states.size());
+    if (!lead && !trail) {
+      states.push_back({{{Label::Any, 0, self}}, self + 1});
+    } else if (!lead) {
+      states.push_back(
+          {{{{Label::Any, 0, self + 1}, {Label::Char, '.', self + 2}}},
+           self + 2});
+      states.push_back(
+          {{{{Label::Any, 0, self + 1}, {Label::Char, '.', self + 2}}}, none});
+    } else if (!trail) {
+      states.push_back({{{Label::Char, '.', self + 1}}, self + 2});
+      states.push_back({{{Label::Any, 0, self + 1}}, self + 2});
+    } else {
+      states.push_back({{{Label::Char, '.', self + 1}}, none});
+      states.push_back(
+          {{{{Label::Any, 0, self + 2}, {Label::Char, '.', self + 3}}},
+           self + 3});
+      states.push_back(
+          {{{{Label::Any, 0, self + 2}, {Label::Char, '.', self + 3}}}, none});
+    }
+  }
+
+  /// Add @p state and its epsilon closure to the bit set @p set.
+  void enter(std::span<uint64_t> set, uint32_t state) const {
+    while (state != none) {
+      auto &word = set[state / 64];
+      auto const bit = uint64_t{1} << (state % 64);
+      if ((word & bit) != 0) {
+        return;
+      }
+      word |= bit;
+      state = states[state].epsilon;
+    }
+  }
+
+  std::vector<State> states;
+  /// The closure of the start states of all patterns.
+  std::vector<uint64_t> initial;
+  /// The accepting state of each pattern.
+  std::vector<uint64_t> accepting;
+  size_t numPatterns = 0;
+};
+
 /// Return true if @p path is @p scope itself or a descendant of it, treating
 /// `.` as the hierarchy separator. So `top.cpu` contains `top.cpu` and
 /// `top.cpu.alu.x`, but not `top.cpu2`. Matching is literal; use
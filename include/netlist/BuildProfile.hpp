@@ -11,14 +11,21 @@ struct BuildProfile {
   double phase2_parallelSeconds = 0; // Parallel DFA dispatch + wait
   double phase3_drainSeconds = 0; // Sequential drain of deferred work
   double phase4_rvalueSeconds = 0; // Sequential pending R-value resolution
+  double simplifySeconds = 0; // Optional pass-through node contraction
 
   // Drain sub-phase timings (seconds).
   double drain_pendingRValuesSeconds = 0;
   double drain_mergesSeconds = 0;
 
+  // Time spent linking staged edges into the graph, in Phase 3 and in a
+  // parallel Phase 4 (seconds).
+  double linkEdgesSeconds = 0;
+
   // Work item counts.
   size_t deferredBlockCount = 0;
   size_t deferredPendingRValueCount = 0;
+  size_t stagedEdgeCount = 0;
+  size_t contractedNodeCount = 0;
 
   // Per-task timing statistics (seconds).
   double taskMinSeconds = 0;
@@ -32,7 +39,7 @@ struct BuildProfile {
   /// Total time across all phases.
   [[nodiscard]] auto totalSeconds() const -> double {
     return phase1_collectSeconds + phase2_parallelSeconds +
-           phase3_drainSeconds + phase4_rvalueSeconds;
+           phase3_drainSeconds + phase4_rvalueSeconds + simplifySeconds;
   }
 };
 
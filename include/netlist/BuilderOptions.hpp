@@ -36,6 +36,12 @@ struct BuilderOptions {
   /// the parallel resolution path.
   std::size_t parallelRValueThreshold = 1000;
 
+  /// When true, contract pass-through Assignment, Merge and single-input
+  /// Conditional nodes once the graph is built (see
+  /// `NetlistGraph::contractPassThroughNodes`). Off by default, since the
+  /// contracted nodes no longer appear in query results.
+  bool simplify = false;
+
   /// Glob patterns matched against each instance's definition name and
   /// hierarchical path. Matched instances get port nodes and external
   /// wiring but their body is not visited, so paths terminate at the
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "netlist/NetlistGraph.hpp"
+#include "netlist/NetlistNode.hpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace slang::netlist {
+
+/// The clock domain of every node in a netlist graph: the set of (source,
+/// edge kind) pairs that NetlistGraph::getSensitivity returns for it,
+/// computed for all nodes in one pass.
+///
+/// The domain of a State node is the set of its own enabled clock edges.
+/// The domain of any other node is the union of the domains of the State
+/// nodes it reaches by enabled edges through non-State nodes. The pass
+/// collapses the combinational loops of the graph into single components
+/// and visits the components from the sinks back, so each component's
+/// domain is the union of those of its immediate successors. Each distinct
+/// set is stored once and numbered, and the union of two numbered sets is
+/// computed once, so nodes in the same domain share both storage and work.
+class ClockDomainMap {
+public:
+  using DomainIndex = uint32_t;
+  using SensitivitySource = NetlistGraph::SensitivitySource;
+
+  /// The domain of a node that reaches no clocked State node.
+  static constexpr DomainIndex empty_domain = 0;
+
+  explicit ClockDomainMap(NetlistGraph const &graph);
+
+  /// Return the number of distinct domains, including the empty domain.
+  [[nodiscard]] auto numDomains() const -> size_t {
+    return firstSource.size() - 1;
+  }
+
+  /// Return the domain of @p node.
+  [[nodiscard]] auto getDomain(NetlistNode const &node) const -> DomainIndex {
+    SLANG_ASSERT(graph.getNodeListVersion() == version);
+    return domains[node.getGraphIndex()];
+  }
+
+  /// Return the sources of @p domain, ordered by the graph index of the
+  /// source node and then by edge kind.
+  [[nodiscard]] auto getSources(DomainIndex domain) const
+      -> std::span<SensitivitySource const> {
+    return std::span<SensitivitySource const>(sources).subspan(
+        firstSource[domain], firstSource[domain + 1] - firstSource[domain]);
+  }
+
+  /// Return the clocks gating @p node: the same set as
+  /// NetlistGraph::getSensitivity, in the order of getSources().
+  [[nodiscard]] auto getSensitivity(NetlistNode const &node) const
+      -> std::span<SensitivitySource const> {
+    return getSources(getDomain(node));
+  }
+
+  /// Return the node list version of the graph when the map was built.
+  [[nodiscard]] auto getVersion() const -> size_t { return version; }
+
+private:
+  NetlistGraph const &graph;
+  size_t version;
+
+  /// The domain of each node, by graph index.
+  std::vector<DomainIndex> domains;
+
+  /// The sources of domain d are sources[firstSource[d]] up to
+  /// sources[firstSource[d + 1]].
+  std::vector<uint32_t> firstSource;
+  std::vector<SensitivitySource> sources;
+};
+
+} // namespace slang::netlist
@@ -7,15 +7,48 @@
 
 namespace slang::netlist {
 
-/// Find combinational loops in a netlist by detecting cycles whose
-/// edges are all combinational.
+/// Find combinational loops in a netlist: cycles whose edges are all
+/// enabled and none of which enters a State node.
+///
+/// Every loop lies within one strongly connected component of the
+/// combinational graph, so the components are found first, with one pass of
+/// Tarjan's algorithm; a component contains a loop if it has more than one
+/// node or a node with an edge to itself. The elementary loops of each such
+/// component are then enumerated with Johnson's algorithm, searching from
+/// each node only the strongly connected component it lies in among the
+/// nodes from it up, with the components searched in parallel. A component
+/// of wide feedback can contain exponentially many loops, so the number
+/// enumerated per component is limited, by default to
+/// defaultLoopsPerComponent.
 class CombLoops {
   NetlistGraph const &netlist;
 
 public:
+  /// The number of loops getAllLoops enumerates per component by default.
+  static constexpr size_t defaultLoopsPerComponent = 100;
+
   CombLoops(NetlistGraph const &netlist) : netlist(netlist) {}
 
-  auto getAllLoops() -> std::vector<std::vector<const NetlistNode *>>;
+  /// Return the nodes of each strongly connected component that contains a
+  /// loop. The nodes of each component are in ascending ID order, and the
+  /// components are ordered by their first node.
+  [[nodiscard]] auto getLoopComponents() const
+      -> std::vector<std::vector<const NetlistNode *>>;
+
+  /// Return the elementary loops of the netlist, at most
+  /// @p maxLoopsPerComponent from each component, or all of them if it is
+  /// zero, which can take time exponential in the size of a component. Each
+  /// loop starts at its node with the lowest ID, and the loops are sorted
+  /// by the IDs of their nodes. Components are searched on the graph's
+  /// query pool.
+  ///
+  /// If @p truncated is given, it is set to the components, as
+  /// getLoopComponents returns them, that have more loops than the limit,
+  /// so that only some of their loops are returned.
+  [[nodiscard]] auto getAllLoops(
+      size_t maxLoopsPerComponent = defaultLoopsPerComponent,
+      std::vector<std::vector<const NetlistNode *>> *truncated = nullptr) const
+      -> std::vector<std::vector<const NetlistNode *>>;
 };
 
 } // namespace slang::netlist
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "netlist/NetlistGraph.hpp"
+#include "netlist/NetlistNode.hpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace slang::netlist {
+
+/// The sources of the combinational fan-in of every node in a netlist
+/// graph, which classify each node as NetlistGraph::getConstantDrivers
+/// does, computed for all nodes in one pass.
+///
+/// The fan-in of a node is the set of nodes that reach it by enabled edges
+/// from non-State nodes, not counting the node itself. The pass collapses
+/// the combinational loops of the graph into single components and visits
+/// the components from the sources forward, so each component's fan-in is
+/// the union of those of its immediate predecessors. The Constant nodes of
+/// each fan-in are stored as numbered sets shared by every node with the
+/// same constants, so finding every tied-off node of a design takes time
+/// linear in the size of the graph.
+class ConstantDriverMap {
+public:
+  /// What the fan-in of a node depends on.
+  enum class DriveKind : uint8_t {
+    /// Nothing: the fan-in contains no Constant, State or input.
+    None,
+    /// Only Constant nodes.
+    Constant,
+    /// A State node feeds the fan-in.
+    State,
+    /// No State node feeds the fan-in, but it contains an undriven Port,
+    /// which is a top-level input.
+    External,
+  };
+
+  explicit ConstantDriverMap(NetlistGraph const &graph);
+
+  /// Return what the fan-in of @p node depends on.
+  [[nodiscard]] auto getDriveKind(NetlistNode const &node) const
+      -> DriveKind {
+    return driveKinds[indexOf(node)];
+  }
+
+  /// Return the Constant nodes in the fan-in of @p node, whatever else is
+  /// in it, in graph order.
+  [[nodiscard]] auto getConstants(NetlistNode const &node) const
+      -> std::span<NetlistNode *const> {
+    auto set = constantSets[indexOf(node)];
+    return std::span<NetlistNode *const>(constants).subspan(
+        firstConstant[set], firstConstant[set + 1] - firstConstant[set]);
+  }
+
+  /// Return the Constant nodes feeding @p node if its fan-in contains only
+  /// Constants, and otherwise an empty span: the same set as
+  /// NetlistGraph::getConstantDrivers, in graph order.
+  [[nodiscard]] auto getConstantDrivers(NetlistNode const &node) const
+      -> std::span<NetlistNode *const> {
+    if (getDriveKind(node) != DriveKind::Constant) {
+      return {};
+    }
+    return getConstants(node);
+  }
+
+  /// Return the number of distinct sets of Constant nodes, including the
+  /// empty set.
+  [[nodiscard]] auto numConstantSets() const -> size_t {
+    return firstConstant.size() - 1;
+  }
+
+  /// Return the node list version of the graph when the map was built.
+  [[nodiscard]] auto getVersion() const -> size_t { return version; }
+
+private:
+  /// Return the graph index of @p node, which must be of the graph as it
+  /// was when the map was built.
+  [[nodiscard]] auto indexOf(NetlistNode const &node) const -> size_t {
+    SLANG_ASSERT(graph.getNodeListVersion() == version);
+    return node.getGraphIndex();
+  }
+
+  NetlistGraph const &graph;
+  size_t version;
+
+  /// The drive kind and set of Constant nodes of each node, by graph
+  /// index.
+  std::vector<DriveKind> driveKinds;
+  std::vector<uint32_t> constantSets;
+
+  /// The Constant nodes of set s are constants[firstConstant[s]] up to
+  /// constants[firstConstant[s + 1]].
+  std::vector<uint32_t> firstConstant;
+  std::vector<NetlistNode *> constants;
+};
+
+} // namespace slang::netlist
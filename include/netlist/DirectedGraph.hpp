@@ -5,8 +5,13 @@
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <new>
+#include <span>
+#include <utility>
 #include <vector>
 
+#include "netlist/GraphArena.hpp"
+
 #include "slang/util/FlatMap.h"
 
 namespace slang::netlist {
@@ -17,6 +22,17 @@ public:
   DirectedEdge(NodeType &sourceNode, NodeType &targetNode)
       : sourceNode(sourceNode), targetNode(targetNode) {}
 
+  /// Destroy an edge. Edges allocated in a GraphArena only have their
+  /// destructor run; their storage is released with the arena.
+  void operator delete(DirectedEdge *edge, std::destroying_delete_t) {
+    auto *derived = static_cast<EdgeType *>(edge);
+    bool inArena = edge->inArena;
+    derived->~EdgeType();
+    if (!inArena) {
+      ::operator delete(derived, sizeof(EdgeType));
+    }
+  }
+
   auto operator=(const DirectedEdge<NodeType, EdgeType> &edge)
       -> DirectedEdge<NodeType, EdgeType> & = default;
 
@@ -49,6 +65,12 @@ protected:
 
   NodeType &sourceNode;
   NodeType &targetNode;
+
+private:
+  template <class, class> friend class Node;
+
+  /// Whether this edge was allocated in a GraphArena.
+  bool inArena{false};
 };
 
 /// A class to represent a node in a directed graph.
@@ -56,7 +78,13 @@ protected:
 /// Edges are owned by their source node via std::unique_ptr in @c outEdges.
 /// The target node stores a raw pointer in @c inEdges; lifetime is bounded
 /// by the source's outEdges entry.
+///
+/// Edge mutation is not synchronised. Concurrent builders must ensure that
+/// each node's outgoing and incoming edge lists are each modified by at
+/// most one thread at a time (see appendOutEdge() and appendInEdge()).
 template <class NodeType, class EdgeType> class Node {
+  template <class, class> friend class DirectedGraph;
+
 public:
   using OutEdgePtrType = std::unique_ptr<EdgeType>;
   using OutEdgeListType = std::vector<OutEdgePtrType>;
@@ -70,7 +98,18 @@ public:
   Node() = default;
   virtual ~Node() = default;
 
-  // Non-copyable/non-movable: edgeMutex is not movable.
+  /// Destroy a node. Nodes allocated in a GraphArena only have their
+  /// destructor run; their storage is released with the arena.
+  void operator delete(Node *node, std::destroying_delete_t) {
+    void *storage = dynamic_cast<void *>(node);
+    bool inArena = node->inArena;
+    node->~Node();
+    if (!inArena) {
+      ::operator delete(storage);
+    }
+  }
+
+  // Non-copyable/non-movable: edges refer to their nodes by reference.
   Node(const Node &) = delete;
   Node(Node &&) = delete;
   auto operator=(const Node &) -> Node & = delete;
@@ -138,61 +177,62 @@ public:
   /// once @c outEdges grows past @c outEdgeIndexThreshold; below that, a
   /// linear scan over the few outEdges is faster and avoids the map's
   /// empty-control-byte overhead per node.
-  ///
-  /// Thread safety: safe to call concurrently. Lock ordering: source
-  /// edgeMutex before target edgeMutex (self-edges use a single lock).
   auto addEdge(NodeType &targetNode) -> EdgeType & {
-    bool isSelfEdge = (&getDerived() == &targetNode);
-    std::lock_guard<std::mutex> lock(edgeMutex);
     if (auto *existing = lookupOutEdge(targetNode); existing != nullptr) {
       return *existing;
     }
-    auto edge = std::make_unique<EdgeType>(getDerived(), targetNode);
-    auto *edgePtr = edge.get();
-    outEdges.emplace_back(std::move(edge));
-    insertOutEdgeIndex(&targetNode, edgePtr);
-    if (isSelfEdge) {
-      inEdges.push_back(edgePtr);
-    } else {
-      std::lock_guard<std::mutex> lock2(targetNode.edgeMutex);
-      targetNode.inEdges.push_back(edgePtr);
-    }
-    return *edgePtr;
+    auto &edge = appendOutEdge(targetNode);
+    targetNode.appendInEdge(edge);
+    return edge;
   }
 
   /// Unconditionally add a new edge between this node and a target node,
   /// even if one already exists (creating a parallel edge). The
   /// outEdgeIndex is left untouched: it points at the *first* edge to the
   /// target.
-  ///
-  /// Thread safety: safe to call concurrently. Lock ordering: source
-  /// edgeMutex before target edgeMutex (self-edges use a single lock).
   auto addNewEdge(NodeType &targetNode) -> EdgeType & {
-    bool isSelfEdge = (&getDerived() == &targetNode);
-    auto edge = std::make_unique<EdgeType>(getDerived(), targetNode);
-    auto *edgePtr = edge.get();
-    if (isSelfEdge) {
-      std::lock_guard<std::mutex> lock(edgeMutex);
-      outEdges.emplace_back(std::move(edge));
-      // If no entry exists yet (caller went straight to addNewEdge), seed
-      // it so a later addEdge dedupes against this edge instead of
-      // creating a third parallel one.
-      tryInsertOutEdgeIndex(&targetNode, edgePtr);
-      inEdges.push_back(edgePtr);
-    } else {
-      {
-        std::lock_guard<std::mutex> lock(edgeMutex);
-        outEdges.emplace_back(std::move(edge));
-        tryInsertOutEdgeIndex(&targetNode, edgePtr);
-      }
-      {
-        std::lock_guard<std::mutex> lock(targetNode.edgeMutex);
-        targetNode.inEdges.push_back(edgePtr);
-      }
+    auto &edge = appendOutEdge(targetNode);
+    targetNode.appendInEdge(edge);
+    return edge;
+  }
+
+  /// Look up the first edge to @p targetNode, via the index when allocated
+  /// or a linear scan over @c outEdges otherwise. Returns nullptr if no
+  /// edge to @p targetNode exists.
+  auto lookupOutEdge(NodeType const &targetNode) -> EdgeType * {
+    if (outEdgeIndex != nullptr) {
+      auto it = outEdgeIndex->find(&targetNode);
+      return it != outEdgeIndex->end() ? it->second : nullptr;
     }
+    auto it = std::ranges::find_if(outEdges, [&](OutEdgePtrType const &e) {
+      return &e->getTargetNode() == &targetNode;
+    });
+    return it != outEdges.end() ? it->get() : nullptr;
+  }
+
+  /// Add a new edge to @p targetNode to this node's outgoing edges only.
+  /// The caller must register it with the target by calling appendInEdge().
+  ///
+  /// Splitting the two halves of addNewEdge() lets a bulk linker create the
+  /// out-edges of each source and the in-edges of each target in separate
+  /// passes, each node touched by one thread at a time, without locking.
+  auto appendOutEdge(NodeType &targetNode) -> EdgeType & {
+    auto edge = createEdge(targetNode);
+    auto *edgePtr = edge.get();
+    outEdges.emplace_back(std::move(edge));
+    // If no entry exists yet, seed it so a later addEdge dedupes against
+    // this edge; otherwise the index keeps pointing at the first edge.
+    tryInsertOutEdgeIndex(&targetNode, edgePtr);
     return *edgePtr;
   }
 
+  /// Register an edge created by appendOutEdge() on its source node as an
+  /// incoming edge of this node.
+  void appendInEdge(EdgeType &edge) {
+    assert(&edge.getTargetNode() == &getDerived());
+    inEdges.push_back(&edge);
+  }
+
   /// Remove an edge between this node and a target node.
   /// Return true if the edge existed and was removed, and false otherwise.
   auto removeEdge(NodeType &targetNode) -> bool {
@@ -261,12 +301,12 @@ public:
   /// Return the total number of edges outgoing from this node.
   auto outDegree() const -> size_t { return outEdges.size(); }
 
-protected:
-  /// Per-node mutex protecting inEdges and outEdges.
-  /// Lock ordering: when locking two nodes, always lock the source node
-  /// (the one whose outEdges is modified) before the target node.
-  mutable std::mutex edgeMutex;
+  /// Return the position of this node in its graph's node list, which the
+  /// graph keeps up to date as nodes are added and removed, or the maximum
+  /// @c size_t value if the node is not in a graph.
+  auto getGraphIndex() const -> size_t { return graphIndex; }
 
+protected:
   InEdgeListType inEdges;
   OutEdgeListType outEdges;
 
@@ -274,7 +314,7 @@ protected:
   /// that target. Allocated lazily once @c outEdges grows past
   /// @c outEdgeIndexThreshold so low-fanout nodes pay no per-node map
   /// overhead. Above the threshold the map keeps addEdge O(1) amortized
-  /// regardless of out-degree. Protected by edgeMutex.
+  /// regardless of out-degree.
   using OutEdgeIndex = flat_hash_map<NodeType const *, EdgeType *>;
   std::unique_ptr<OutEdgeIndex> outEdgeIndex;
 
@@ -282,6 +322,16 @@ protected:
   /// the lazily-allocated @c outEdgeIndex map.
   static constexpr size_t outEdgeIndexThreshold = 16;
 
+  /// Arena of the owning graph, from which new edges are allocated. Null
+  /// for nodes not added to a graph.
+  GraphArena *arena{nullptr};
+
+  /// Whether this node was allocated in a GraphArena.
+  bool inArena{false};
+
+  /// Position of this node in the owning graph's node list.
+  size_t graphIndex{std::numeric_limits<size_t>::max()};
+
   // As the default implementation use address comparison for equality.
   auto isEqualTo(const NodeType &node) const -> bool { return this == &node; }
 
@@ -292,6 +342,17 @@ protected:
   }
 
 private:
+  /// Create an edge from this node to @p targetNode, in this node's arena
+  /// if it has one.
+  auto createEdge(NodeType &targetNode) -> OutEdgePtrType {
+    if (arena == nullptr) {
+      return std::make_unique<EdgeType>(getDerived(), targetNode);
+    }
+    OutEdgePtrType edge(arena->create<EdgeType>(getDerived(), targetNode));
+    edge->inArena = true;
+    return edge;
+  }
+
   /// Remove the reference to an incoming edge from a source node to this
   /// node. This method should only be called as part of removing an output
   /// edge. Return true if the edge existed and was removed, and false
@@ -305,22 +366,8 @@ private:
     return false;
   }
 
-  /// Look up the first edge to @p targetNode, via the index when allocated
-  /// or a linear scan over @c outEdges otherwise. Returns nullptr if no
-  /// edge to @p targetNode exists. Caller must hold @c edgeMutex.
-  auto lookupOutEdge(NodeType const &targetNode) -> EdgeType * {
-    if (outEdgeIndex != nullptr) {
-      auto it = outEdgeIndex->find(&targetNode);
-      return it != outEdgeIndex->end() ? it->second : nullptr;
-    }
-    auto it = std::ranges::find_if(outEdges, [&](OutEdgePtrType const &e) {
-      return &e->getTargetNode() == &targetNode;
-    });
-    return it != outEdges.end() ? it->get() : nullptr;
-  }
-
   /// Materialise @c outEdgeIndex from @c outEdges, recording the first
-  /// edge to each target. Caller must hold @c edgeMutex.
+  /// edge to each target.
   void buildOutEdgeIndex() {
     outEdgeIndex = std::make_unique<OutEdgeIndex>();
     outEdgeIndex->reserve(outEdges.size());
@@ -329,19 +376,10 @@ private:
     }
   }
 
-  /// Insert a fresh (target, edge) entry into @c outEdgeIndex, allocating
-  /// the index when crossing @c outEdgeIndexThreshold. Caller must hold
-  /// @c edgeMutex and have already pushed the edge onto @c outEdges.
-  void insertOutEdgeIndex(NodeType const *targetNode, EdgeType *edgePtr) {
-    if (outEdgeIndex != nullptr) {
-      outEdgeIndex->emplace(targetNode, edgePtr);
-    } else if (outEdges.size() > outEdgeIndexThreshold) {
-      buildOutEdgeIndex();
-    }
-  }
-
-  /// Index variant for addNewEdge: only seed the entry if the target is
-  /// not already mapped, so the index keeps pointing at the first edge.
+  /// Seed the @c outEdgeIndex entry for a freshly-pushed edge if the target
+  /// is not already mapped, so the index keeps pointing at the first edge,
+  /// allocating the index when crossing @c outEdgeIndexThreshold. The
+  /// caller must have already pushed the edge onto @c outEdges.
   void tryInsertOutEdgeIndex(NodeType const *targetNode, EdgeType *edgePtr) {
     if (outEdgeIndex != nullptr) {
       outEdgeIndex->try_emplace(targetNode, edgePtr);
@@ -355,6 +393,10 @@ private:
 /// Nodes and edges are stored in an adjacency list data structure, where the
 /// DirectedGraph contains a vector of nodes, and each node contains a vector
 /// of directed edges to other nodes. Multi-edges are not permitted.
+///
+/// Nodes created with emplaceNode(), and all edges between nodes of the
+/// graph, are allocated in graph-owned GraphArenas, one for nodes and one
+/// for edges, and freed in bulk when the graph is destroyed.
 template <class NodeType, class EdgeType> class DirectedGraph {
 public:
   using NodePtrType = std::unique_ptr<NodeType>;
@@ -374,13 +416,13 @@ public:
   auto begin() -> iterator { return nodes.begin(); }
   auto end() -> iterator { return nodes.end(); }
 
+  /// Return the descriptor of the specified node, or null_node if it is
+  /// not in the graph. O(1): each node records its own position in the
+  /// node list.
   auto findNode(const NodeType &nodeToFind) const -> node_descriptor {
-    auto it =
-        std::ranges::find_if(nodes, [&nodeToFind](const NodePtrType &node) {
-          return const_cast<const NodeType &>(*node) == nodeToFind;
-        });
-    if (it != nodes.end()) {
-      return it - nodes.begin();
+    auto index = nodeToFind.graphIndex;
+    if (index < nodes.size() && nodes[index].get() == &nodeToFind) {
+      return index;
     }
     return null_node;
   }
@@ -394,38 +436,98 @@ public:
   /// Add a node to the graph and return a reference to it.
   ///
   /// Thread safety: safe to call concurrently from multiple threads.
-  auto addNode() -> NodeType & {
-    std::lock_guard<std::mutex> lock(nodesMutex);
-    nodes.push_back(std::make_unique<NodeType>());
-    return *(nodes.back().get());
+  auto addNode() -> NodeType & { return emplaceNode<NodeType>(); }
+
+  /// Construct a node of type @p T in the graph's arena, add it to the graph
+  /// and return a reference to it.
+  ///
+  /// Thread safety: safe to call concurrently from multiple threads.
+  template <class T, class... Args> auto emplaceNode(Args &&...args) -> T & {
+    NodePtrType node(arena.create<T>(std::forward<Args>(args)...));
+    node->inArena = true;
+    auto &result = static_cast<T &>(*node);
+    addNode(std::move(node));
+    return result;
   }
 
   /// Add an existing node to the graph and return a reference to it.
   ///
   /// Thread safety: safe to call concurrently from multiple threads.
   auto addNode(std::unique_ptr<NodeType> node) -> NodeType & {
+    node->arena = &edgeArena;
     std::lock_guard<std::mutex> lock(nodesMutex);
+    node->graphIndex = nodes.size();
     nodes.push_back(std::move(node));
+    nodeListVersion++;
     return *(nodes.back().get());
   }
 
+  /// Return the allocation statistics of the graph's node and edge arenas
+  /// combined.
+  [[nodiscard]] auto getArenaStats() const -> GraphArena::Stats {
+    auto stats = arena.getStats();
+    stats += edgeArena.getStats();
+    return stats;
+  }
+
+  /// Return the allocation statistics of the graph's edge arena alone.
+  [[nodiscard]] auto getEdgeArenaStats() const -> GraphArena::Stats {
+    return edgeArena.getStats();
+  }
+
   /// Remove the specified node from the graph, including all edges that are
   /// incident upon this node, and all edges that are outgoing from this node.
   /// Return true if the node exists and was removed and false if it didn't
-  /// exist.
+  /// exist. The nodes after it are shifted down, so to remove many nodes
+  /// use removeNodes() instead.
   auto removeNode(NodeType &nodeToRemove) -> bool {
     auto nodeToRemoveDesc = findNode(nodeToRemove);
-    if (nodeToRemoveDesc >= nodes.size()) {
+    if (nodeToRemoveDesc == null_node) {
       // The node is not in the graph.
       return false;
     }
     // Remove all edges to and from the node for removal.
     nodeToRemove.clearAllEdges();
+    nodeToRemove.graphIndex = null_node;
     // Remove the node itself.
     nodes.erase(std::ranges::next(nodes.begin(), nodeToRemoveDesc));
+    renumberNodes(nodeToRemoveDesc);
+    nodeListVersion++;
     return true;
   }
 
+  /// Remove the specified nodes from the graph, including all of their
+  /// incident edges. Nodes that are not in the graph, and repeated nodes,
+  /// are ignored. The node list is compacted in a single pass that
+  /// preserves the order of the remaining nodes, so removing many nodes
+  /// costs linear time overall. Return the number of nodes removed.
+  auto removeNodes(std::span<NodeType *const> nodesToRemove) -> size_t {
+    size_t removed = 0;
+    size_t firstRemoved = nodes.size();
+    for (auto *node : nodesToRemove) {
+      auto desc = findNode(*node);
+      if (desc == null_node) {
+        continue;
+      }
+      node->clearAllEdges();
+      // Mark the node for removal; findNode() no longer sees it, so repeats
+      // are skipped.
+      node->graphIndex = null_node;
+      firstRemoved = std::min(firstRemoved, desc);
+      removed++;
+    }
+    if (removed == 0) {
+      return 0;
+    }
+    auto tail = std::ranges::remove_if(nodes, [](NodePtrType const &node) {
+      return node->graphIndex == null_node;
+    });
+    nodes.erase(tail.begin(), tail.end());
+    renumberNodes(firstRemoved);
+    nodeListVersion++;
+    return removed;
+  }
+
   /// Add an edge between two existing nodes in the graph.
   auto addEdge(NodeType &sourceNode, NodeType &targetNode) -> EdgeType & {
     assert(findNode(sourceNode) < nodes.size() && "Source node does not exist");
@@ -464,6 +566,10 @@ public:
   /// Return the size of the graph.
   auto numNodes() const -> size_t { return nodes.size(); }
 
+  /// Return a counter that changes whenever nodes are added or removed, so
+  /// that tables indexed by graph index can detect when they are stale.
+  auto getNodeListVersion() const -> size_t { return nodeListVersion; }
+
   /// Return the number of edges in the graph.
   auto numEdges() const -> size_t {
     size_t count = 0;
@@ -474,11 +580,41 @@ public:
   }
 
 protected:
+  /// Destroy every edge of the graph and release the edge arena, keeping
+  /// the nodes, whose edge lists are left empty. Edges must only connect
+  /// nodes of this graph.
+  void releaseAllEdges() {
+    for (auto &node : nodes) {
+      node->outEdgeIndex.reset();
+      typename NodeType::OutEdgeListType().swap(node->outEdges);
+      typename NodeType::InEdgeListType().swap(node->inEdges);
+    }
+    edgeArena.reset();
+  }
+
+  /// Record the position of each node from @p first onwards after the node
+  /// list has been shifted.
+  void renumberNodes(size_t first) {
+    for (size_t i = first; i < nodes.size(); ++i) {
+      nodes[i]->graphIndex = i;
+    }
+  }
+
   /// Mutex protecting the nodes vector. Only addNode() acquires this;
   /// iteration and read-only access are safe after build() completes.
   mutable std::mutex nodesMutex;
 
+  /// Storage for nodes and edges, kept apart so that the edges can be
+  /// released on their own. Declared before @c nodes so that they outlive
+  /// them.
+  GraphArena arena;
+  GraphArena edgeArena;
+
   NodeListType nodes;
+
+  /// Incremented by every change to the node list. Guarded by nodesMutex
+  /// in addNode().
+  size_t nodeListVersion = 0;
 };
 
 } // namespace slang::netlist
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "netlist/DriverBitRange.hpp"
+#include "netlist/FrozenNetlist.hpp"
+#include "netlist/SymbolReference.hpp"
+
+#include "slang/util/FlatMap.h"
+
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace slang::netlist {
+
+/// An index of the edges of a FrozenNetlist by the symbol and bit range
+/// they drive.
+///
+/// Symbols are keyed by hierarchical path, not by record, so that an edge
+/// is found by the same name comparison as an edge scan, even if its
+/// symbol was interned in another table. The annotated edges of each path
+/// are held in a contiguous bucket, sorted by the lower bound of their
+/// range. The bucket is read as an implicit balanced search tree, the
+/// middle entry of each subrange being the root of the subtree over it,
+/// and each entry records the greatest upper bound in its subtree. A query
+/// for the edges driving part of a symbol finds the bucket with one hash
+/// lookup, then descends only into subtrees that can hold an overlapping
+/// range, so it costs O((k + 1) log n) for a symbol with n driving edges,
+/// k of which overlap the query, rather than a scan of every edge in the
+/// graph.
+///
+/// The index refers to edges by their snapshot index and is only valid for
+/// the lifetime of the snapshot it was built from.
+class DriverIndex {
+public:
+  using EdgeIndex = FrozenNetlist::EdgeIndex;
+
+  explicit DriverIndex(FrozenNetlist const &graph);
+
+  /// Return the edges annotated with a symbol of hierarchical path @p path
+  /// whose bounds overlap @p bounds, in ascending edge index order (which
+  /// is the order of a scan over the graph's out-edges).
+  [[nodiscard]] auto find(std::string_view path, DriverBitRange bounds) const
+      -> std::vector<EdgeIndex>;
+
+  /// Return the number of symbol paths with at least one driving edge.
+  [[nodiscard]] auto numSymbols() const -> size_t { return buckets.size(); }
+
+private:
+  struct Entry {
+    int32_t lower;
+    int32_t upper;
+    /// The largest upper bound of the entries of the subtree this entry is
+    /// the root of.
+    int32_t subtreeUpper;
+    EdgeIndex edge;
+  };
+
+  /// The entries of one symbol path: entries[offset, offset + size).
+  struct Bucket {
+    uint32_t offset;
+    uint32_t size;
+  };
+
+  /// Hash paths as string views, so that a query need not copy its name.
+  struct PathHash {
+    using is_transparent = void;
+    auto operator()(std::string_view path) const -> size_t {
+      return std::hash<std::string_view>{}(path);
+    }
+  };
+
+  /// Set the subtree bounds of the entries of @p tree, returning the
+  /// largest upper bound in it.
+  static auto buildTree(std::span<Entry> tree) -> int32_t;
+
+  /// Add the edges of the entries of @p tree overlapping
+  /// [@p lower, @p upper] to @p result.
+  static void searchTree(std::span<Entry const> tree, int32_t lower,
+                         int32_t upper, std::vector<EdgeIndex> &result);
+
+  flat_hash_map<std::string, Bucket, PathHash, std::equal_to<>> buckets;
+  std::vector<Entry> entries;
+};
+
+} // namespace slang::netlist
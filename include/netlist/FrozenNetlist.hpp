@@ -0,0 +1,184 @@
+#pragma once
+
+#include "netlist/DirectedGraph.hpp"
+#include "netlist/DriverBitRange.hpp"
+#include "netlist/NetlistEdge.hpp"
+#include "netlist/NetlistNode.hpp"
+#include "netlist/SymbolReference.hpp"
+
+#include "slang/ast/SemanticFacts.h"
+
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <vector>
+
+namespace slang::netlist {
+
+/// A read-only compressed-sparse-row (CSR) snapshot of a netlist graph.
+///
+/// Nodes are numbered densely in graph order, matching their graph indices.
+/// The out-edges of node @c n occupy the contiguous edge indices
+/// @c [outOffsets[n], outOffsets[n+1]), in the same order as the node's
+/// @c outEdges, so an edge index doubles as a position in the per-edge
+/// attribute arrays. In-edges are stored as a second CSR over edge
+/// indices, preserving each node's @c inEdges order.
+/// Traversals over the snapshot therefore visit nodes in exactly the same
+/// order as traversals over the pointer-based graph.
+///
+/// Each edge is stored as a 16-byte PackedEdge holding its endpoints, an
+/// index into the snapshot's list of distinct symbols, its bit bounds and
+/// its kind and disabled flag, so an edge costs 20 bytes including its
+/// in-edge entry. The accessors unpack these fields.
+///
+/// The snapshot refers to the nodes of the graph it was built from, by
+/// their graph index, but not to its edges: it holds everything needed to
+/// answer queries and to rebuild the edges, so the graph can release its
+/// pointer-based edges while frozen (see NetlistGraph::freeze). It is
+/// invalidated by any other mutation of that graph.
+class FrozenNetlist {
+public:
+  using NodeIndex = uint32_t;
+  using EdgeIndex = uint32_t;
+
+  static constexpr NodeIndex null_index = std::numeric_limits<uint32_t>::max();
+
+  /// The attributes of one edge, packed into 16 bytes.
+  struct PackedEdge {
+    NodeIndex source;
+    NodeIndex target;
+    /// Bits 0-27 index the snapshot's symbol list (0 for no symbol), bits
+    /// 28-29 hold the ast::EdgeKind, bit 30 is set if the edge is disabled
+    /// and bit 31 if the bounds are stored out of line.
+    uint32_t attributes;
+    /// The bounds as @c (left << 16) | right when both ends lie in
+    /// [0, 65535], otherwise an index into the snapshot's wide bounds list.
+    uint32_t bounds;
+
+    static constexpr uint32_t symbolBits = 28;
+    static constexpr uint32_t symbolMask = (uint32_t{1} << symbolBits) - 1;
+    static constexpr uint32_t kindShift = symbolBits;
+    static constexpr uint32_t kindMask = 0x3;
+    static constexpr uint32_t disabledBit = uint32_t{1} << 30;
+    static constexpr uint32_t wideBoundsBit = uint32_t{1} << 31;
+  };
+  static_assert(sizeof(PackedEdge) == 16);
+  static_assert(static_cast<uint32_t>(ast::EdgeKind::BothEdges) <=
+                PackedEdge::kindMask);
+
+  explicit FrozenNetlist(DirectedGraph<NetlistNode, NetlistEdge> const &graph);
+
+  /// Return the number of nodes in the snapshot.
+  [[nodiscard]] auto numNodes() const -> size_t { return nodeKinds.size(); }
+
+  /// Return the number of edges in the snapshot.
+  [[nodiscard]] auto numEdges() const -> size_t { return edges.size(); }
+
+  /// Return the node with dense index @p index.
+  [[nodiscard]] auto getNode(NodeIndex index) const -> NetlistNode & {
+    SLANG_ASSERT(index < nodeKinds.size());
+    return graph.getNode(index);
+  }
+
+  /// Return the dense index of @p node, or @c null_index if the node was not
+  /// part of the graph when the snapshot was taken. Dense indices are the
+  /// nodes' graph indices, so this is a single bounds-checked load.
+  [[nodiscard]] auto getIndex(NetlistNode const &node) const -> NodeIndex {
+    auto index = node.getGraphIndex();
+    if (index < nodeKinds.size() && &graph.getNode(index) == &node) {
+      return static_cast<NodeIndex>(index);
+    }
+    return null_index;
+  }
+
+  /// Return the kind of the node with dense index @p index.
+  [[nodiscard]] auto getKind(NodeIndex index) const -> NodeKind {
+    return nodeKinds[index];
+  }
+
+  /// Return the indices of the edges leaving node @p index.
+  [[nodiscard]] auto outEdges(NodeIndex index) const {
+    return std::views::iota(outOffsets[index], outOffsets[index + 1]);
+  }
+
+  /// Return the indices of the edges entering node @p index.
+  [[nodiscard]] auto inEdges(NodeIndex index) const
+      -> std::span<EdgeIndex const> {
+    return std::span<EdgeIndex const>(inEdgeIds).subspan(
+        inOffsets[index], inOffsets[index + 1] - inOffsets[index]);
+  }
+
+  [[nodiscard]] auto outDegree(NodeIndex index) const -> size_t {
+    return outOffsets[index + 1] - outOffsets[index];
+  }
+
+  [[nodiscard]] auto inDegree(NodeIndex index) const -> size_t {
+    return inOffsets[index + 1] - inOffsets[index];
+  }
+
+  // Per-edge attributes, indexed by edge index.
+
+  [[nodiscard]] auto getSource(EdgeIndex edge) const -> NodeIndex {
+    return edges[edge].source;
+  }
+  [[nodiscard]] auto getTarget(EdgeIndex edge) const -> NodeIndex {
+    return edges[edge].target;
+  }
+  [[nodiscard]] auto getEdgeKind(EdgeIndex edge) const -> ast::EdgeKind {
+    return static_cast<ast::EdgeKind>(
+        (edges[edge].attributes >> PackedEdge::kindShift) &
+        PackedEdge::kindMask);
+  }
+  [[nodiscard]] auto isDisabled(EdgeIndex edge) const -> bool {
+    return (edges[edge].attributes & PackedEdge::disabledBit) != 0;
+  }
+  [[nodiscard]] auto getSymbol(EdgeIndex edge) const
+      -> SymbolReference const * {
+    return symbols[getSymbolIndex(edge)];
+  }
+  /// Return the position of the symbol of @p edge in getSymbols(), which is
+  /// 0 for an edge without a symbol.
+  [[nodiscard]] auto getSymbolIndex(EdgeIndex edge) const -> uint32_t {
+    return edges[edge].attributes & PackedEdge::symbolMask;
+  }
+  [[nodiscard]] auto getBounds(EdgeIndex edge) const -> DriverBitRange {
+    auto const &packed = edges[edge];
+    if ((packed.attributes & PackedEdge::wideBoundsBit) != 0) {
+      return wideBounds[packed.bounds];
+    }
+    return {static_cast<int32_t>(packed.bounds >> 16),
+            static_cast<int32_t>(packed.bounds & 0xffffU)};
+  }
+
+  /// Return the distinct edge symbols of the snapshot, in order of first
+  /// use. Entry 0 is null and stands for edges without a symbol.
+  [[nodiscard]] auto getSymbols() const
+      -> std::span<SymbolReference const *const> {
+    return symbols;
+  }
+
+  /// Return the packed representation of edge @p edge.
+  [[nodiscard]] auto getPackedEdge(EdgeIndex edge) const -> PackedEdge {
+    return edges[edge];
+  }
+
+  /// Return the number of bytes held by the snapshot's arrays.
+  [[nodiscard]] auto memoryBytes() const -> size_t;
+
+private:
+  DirectedGraph<NetlistNode, NetlistEdge> const &graph;
+  std::vector<NodeKind> nodeKinds;
+
+  std::vector<EdgeIndex> outOffsets;
+  std::vector<EdgeIndex> inOffsets;
+  std::vector<EdgeIndex> inEdgeIds;
+
+  std::vector<PackedEdge> edges;
+  /// Distinct edge symbols; entry 0 is null.
+  std::vector<SymbolReference const *> symbols;
+  /// Bounds that do not fit in a PackedEdge.
+  std::vector<DriverBitRange> wideBounds;
+};
+
+} // namespace slang::netlist
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "slang/util/Util.h"
+
+namespace slang::netlist {
+
+/// A bump allocator for graph nodes and edges.
+///
+/// Objects are placement-constructed contiguously in large slabs that are
+/// released together when the arena is destroyed, replacing one heap
+/// allocation per node and per edge. Allocation is lock-free: threads claim
+/// space in the current slab with a compare-and-swap on its cursor, and only
+/// take a mutex to install a fresh slab when the current one is full.
+///
+/// The arena never reclaims individual objects; destroying an object that
+/// lives in the arena only runs its destructor (see the destroying
+/// @c operator @c delete in @c Node and @c DirectedEdge). Memory is returned
+/// when the arena itself is destroyed or reset(), so the arena must outlive
+/// every object allocated from it.
+class GraphArena {
+public:
+  /// Size of a regular slab. Allocations larger than this get a dedicated
+  /// slab of their own.
+  static constexpr size_t slabSize = size_t{1} << 20;
+
+  /// Per-allocation overhead of a general-purpose allocator (a chunk header
+  /// plus rounding to 16 bytes), used to estimate the memory saved.
+  static constexpr size_t mallocOverheadBytes = 16;
+
+  /// Allocation statistics.
+  struct Stats {
+    /// Number of objects allocated.
+    size_t allocations = 0;
+    /// Number of slabs reserved.
+    size_t slabs = 0;
+    /// Bytes handed out, including alignment padding.
+    size_t bytesUsed = 0;
+    /// Bytes reserved across all slabs.
+    size_t bytesReserved = 0;
+
+    /// Add the statistics of another arena.
+    auto operator+=(Stats const &other) -> Stats & {
+      allocations += other.allocations;
+      slabs += other.slabs;
+      bytesUsed += other.bytesUsed;
+      bytesReserved += other.bytesReserved;
+      return *this;
+    }
+
+    /// Estimate of the allocator overhead avoided relative to allocating
+    /// each object individually, net of unused slab space.
+    [[nodiscard]] auto estimatedBytesSaved() const -> size_t {
+      auto overhead = allocations * mallocOverheadBytes;
+      auto unused = bytesReserved - bytesUsed;
+      return overhead > unused ? overhead - unused : 0;
+    }
+  };
+
+  GraphArena() = default;
+  ~GraphArena() = default;
+
+  GraphArena(const GraphArena &) = delete;
+  GraphArena(GraphArena &&) = delete;
+  auto operator=(const GraphArena &) -> GraphArena & = delete;
+  auto operator=(GraphArena &&) -> GraphArena & = delete;
+
+  /// Allocate uninitialised storage of @p size bytes aligned to @p align.
+  ///
+  /// Thread safety: safe to call concurrently.
+  auto allocate(size_t size, size_t align) -> void * {
+    SLANG_ASSERT(align <= alignof(std::max_align_t));
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (size > slabSize / 4) {
+      // Large objects get a dedicated slab rather than wasting the tail of
+      // the current one.
+      std::lock_guard<std::mutex> lock(slabsMutex);
+      auto &slab = newSlab(size);
+      slab.used.store(size, std::memory_order_relaxed);
+      return slab.data.get();
+    }
+    while (true) {
+      auto *slab = current.load(std::memory_order_acquire);
+      if (slab != nullptr) {
+        if (auto *ptr = slab->tryAllocate(size, align); ptr != nullptr) {
+          return ptr;
+        }
+      }
+      std::lock_guard<std::mutex> lock(slabsMutex);
+      // Another thread may have installed a fresh slab in the meantime.
+      if (current.load(std::memory_order_relaxed) == slab) {
+        current.store(&newSlab(slabSize), std::memory_order_release);
+      }
+    }
+  }
+
+  /// Construct an object of type @p T in the arena.
+  ///
+  /// Thread safety: safe to call concurrently.
+  template <class T, class... Args> auto create(Args &&...args) -> T * {
+    void *mem = allocate(sizeof(T), alignof(T));
+    return ::new (mem) T(std::forward<Args>(args)...);
+  }
+
+  /// Release every slab, returning the arena to its initial state. Every
+  /// object allocated from the arena must already have been destroyed.
+  ///
+  /// Thread safety: must not be called concurrently with allocation.
+  void reset() {
+    std::lock_guard<std::mutex> lock(slabsMutex);
+    current.store(nullptr, std::memory_order_relaxed);
+    allocations.store(0, std::memory_order_relaxed);
+    slabs.clear();
+  }
+
+  /// Return the allocation statistics. Not synchronised with concurrent
+  /// allocation.
+  [[nodiscard]] auto getStats() const -> Stats {
+    std::lock_guard<std::mutex> lock(slabsMutex);
+    Stats stats;
+    stats.allocations = allocations.load(std::memory_order_relaxed);
+    stats.slabs = slabs.size();
+    for (auto const &slab : slabs) {
+      stats.bytesUsed += slab->used.load(std::memory_order_relaxed);
+      stats.bytesReserved += slab->size;
+    }
+    return stats;
+  }
+
+private:
+  struct Slab {
+    std::unique_ptr<std::byte[]> data;
+    size_t size;
+    std::atomic<size_t> used{0};
+
+    explicit Slab(size_t size) : data(new std::byte[size]), size(size) {}
+
+    /// Claim @p bytes at @p align in this slab, or return nullptr if the
+    /// slab is full.
+    auto tryAllocate(size_t bytes, size_t align) -> void * {
+      auto offset = used.load(std::memory_order_relaxed);
+      while (true) {
+        auto start = (offset + align - 1) & ~(align - 1);
+        if (start + bytes > size) {
+          return nullptr;
+        }
+        if (used.compare_exchange_weak(offset, start + bytes,
+                                       std::memory_order_relaxed)) {
+          return data.get() + start;
+        }
+      }
+    }
+  };
+
+  /// Add a new slab of at least @p size bytes. Caller must hold slabsMutex.
+  auto newSlab(size_t size) -> Slab & {
+    slabs.push_back(std::make_unique<Slab>(size));
+    return *slabs.back();
+  }
+
+  std::atomic<Slab *> current{nullptr};
+  std::atomic<size_t> allocations{0};
+  mutable std::mutex slabsMutex;
+  std::vector<std::unique_ptr<Slab>> slabs;
+};
+
+} // namespace slang::netlist
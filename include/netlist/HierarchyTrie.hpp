@@ -0,0 +1,110 @@
+#pragma once
+
+#include "netlist/NameIndex.hpp"
+#include "netlist/NetlistNode.hpp"
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace slang::netlist {
+
+/// A trie of the hierarchical paths of the named nodes of a netlist graph,
+/// keyed on their `.`-separated segments.
+///
+/// Glob and scope queries walk the trie one segment at a time, so a query
+/// only visits the subtrees its pattern can match: a literal segment is a
+/// binary search among the children of a trie node, `*` and `?` are
+/// matched against the children of the trie nodes they occupy, and a
+/// segment that is just `**` or `...` stands for zero or more whole
+/// segments. Patterns that mix a recursive wildcard with other characters
+/// in one segment (such as `u_**` or `top...`) are matched segment-wise up
+/// to the segment before it, whose `.` the wildcard may absorb, and then
+/// against every path below with wildcardMatch.
+///
+/// The trie is built from the scope tree of the graph's SymbolTable: the
+/// trie node of each scope is found once, from the trie node of its parent
+/// scope, and each path adds only its leaf below it.
+///
+/// The children of each trie node are stored contiguously, sorted by
+/// segment, and queries return nodes in that order: a pre-order walk of
+/// the hierarchy, with the nodes of one path in graph order.
+class HierarchyTrie {
+public:
+  /// The symbol of a path and its nodes, in graph order.
+  struct Entry {
+    SymbolReference const *symbol;
+    std::span<NetlistNode *const> nodes;
+  };
+
+  explicit HierarchyTrie(NameIndex const &index);
+
+  /// Return the nodes whose hierarchical path matches the glob @p pattern
+  /// (see wildcardMatch for the syntax).
+  [[nodiscard]] auto match(std::string_view pattern) const
+      -> std::vector<NetlistNode *>;
+
+  /// Return the nodes whose hierarchical path is @p scope or a descendant
+  /// of it (see pathInScope).
+  [[nodiscard]] auto inScope(std::string_view scope) const
+      -> std::vector<NetlistNode *>;
+
+  /// Return the paths that begin with the string @p prefix, which need not
+  /// end on a segment boundary, in a pre-order walk of the hierarchy.
+  [[nodiscard]] auto withPrefix(std::string_view prefix) const
+      -> std::vector<Entry>;
+
+  /// Return the number of trie nodes, including the root.
+  [[nodiscard]] auto size() const -> size_t { return trieNodes.size(); }
+
+  /// Return the node list version of the graph when the trie was built.
+  [[nodiscard]] auto getVersion() const -> size_t { return version; }
+
+private:
+  struct TrieNode {
+    std::string_view segment;
+    uint32_t parent;
+    uint32_t firstChild;
+    uint32_t numChildren;
+    /// Position in a pre-order walk of the trie.
+    uint32_t rank;
+    /// The symbol and graph nodes of the path ending at this trie node, if
+    /// any.
+    SymbolReference const *symbol;
+    std::span<NetlistNode *const> nodes;
+  };
+
+  /// The state of one glob query (defined in the implementation).
+  struct Query;
+
+  static constexpr uint32_t root = 0;
+
+  [[nodiscard]] auto children(uint32_t node) const
+      -> std::span<TrieNode const> {
+    auto const &trieNode = trieNodes[node];
+    return std::span<TrieNode const>(trieNodes).subspan(
+        trieNode.firstChild, trieNode.numChildren);
+  }
+
+  /// Return the child of @p node with segment @p segment, or @c root if
+  /// there is none.
+  [[nodiscard]] auto findChild(uint32_t node, std::string_view segment) const
+      -> uint32_t;
+
+  /// Call @p visit with each trie node in the subtree of @p node, in
+  /// pre-order.
+  template <typename Visit>
+  void forEachInSubtree(uint32_t node, Visit &&visit) const;
+
+  /// Match the pattern segments of @p query from @p segment onwards
+  /// against the paths below @p node.
+  void matchFrom(Query &query, uint32_t node, size_t segment) const;
+
+  /// In breadth-first order, so the children of a node are contiguous.
+  std::vector<TrieNode> trieNodes;
+
+  size_t version;
+};
+
+} // namespace slang::netlist
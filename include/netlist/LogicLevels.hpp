@@ -0,0 +1,104 @@
+#pragma once
+
+#include "netlist/NetlistGraph.hpp"
+#include "netlist/NetlistNode.hpp"
+#include "netlist/NetlistPath.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace slang::netlist {
+
+/// The combinational logic depth of every node in a netlist graph.
+///
+/// The level of a node is the greatest number of logic nodes (Assignment,
+/// Conditional and Case nodes) on a path of combinational edges ending at
+/// it, counting the node itself: enabled edges that do not enter a State
+/// node, as for NetlistGraph::getCombFanIn. A State node is thus at level
+/// 0, and the depth of the logic in front of it is the greatest level of a
+/// node driving it by an enabled data edge.
+///
+/// The strongly connected components of the combinational graph (its
+/// loops) are collapsed first, so every node of a loop has the same level,
+/// counting each logic node of the loop once. The levels are then computed
+/// by a topological sort of the components a frontier at a time: every
+/// component whose predecessors are all done is in the next frontier, and
+/// the components of a large frontier are processed in parallel. Each
+/// component records the predecessor it takes its level from, so a
+/// deepest path to any node can be traced back without a search. Building
+/// the levels takes time linear in the size of the graph.
+class LogicLevels {
+public:
+  /// Compute the levels of @p graph, using up to the number of threads it
+  /// was built with.
+  explicit LogicLevels(NetlistGraph const &graph);
+
+  /// Return the level of @p node.
+  [[nodiscard]] auto getLevel(NetlistNode const &node) const -> uint32_t {
+    return levels[components[indexOf(node)]];
+  }
+
+  /// Return the depth of the logic in front of @p node: the greatest level
+  /// of a node driving it by an enabled data edge if it is a State node,
+  /// and otherwise its level.
+  [[nodiscard]] auto getDepth(NetlistNode const &node) const -> uint32_t;
+
+  /// Return the greatest level of any node.
+  [[nodiscard]] auto maxLevel() const -> uint32_t { return highestLevel; }
+
+  /// Return the number of frontiers the topological sort took, which is
+  /// the number of components on the longest chain of them.
+  [[nodiscard]] auto numFrontiers() const -> size_t { return frontierCount; }
+
+  /// Return the State nodes and top-level ports of the graph, the endpoints
+  /// of SequentialGraph, in order of decreasing depth and then graph order.
+  [[nodiscard]] auto getEndpointsByDepth() const -> std::vector<NetlistNode *>;
+
+  /// Return a path ending at @p node with as many logic nodes in front of
+  /// it as its depth, starting where its combinational fan-in does: at a
+  /// node with none, or on a loop with none from outside it. Within a loop
+  /// the path takes a shortest route between the nodes it enters and
+  /// leaves the loop by, so a path through a loop can have fewer logic
+  /// nodes than its depth counts.
+  [[nodiscard]] auto getDeepestPath(NetlistNode &node) const -> NetlistPath;
+
+  /// Return the node list version of the graph when the levels were built.
+  [[nodiscard]] auto getVersion() const -> size_t { return version; }
+
+private:
+  /// Return the graph index of @p node, asserting that the graph has the
+  /// nodes the levels were computed for.
+  [[nodiscard]] auto indexOf(NetlistNode const &node) const -> uint32_t {
+    SLANG_ASSERT(graph.getNodeListVersion() == version);
+    return static_cast<uint32_t>(node.getGraphIndex());
+  }
+
+  /// Return the path ending at @p node, which is at its own level, by
+  /// tracing back the recorded predecessors.
+  void tracePath(uint32_t node, std::vector<uint32_t> &path) const;
+
+  NetlistGraph const &graph;
+  size_t version;
+
+  /// The combinational successors and predecessors of each node, by graph
+  /// index, in compressed sparse row form.
+  std::vector<uint32_t> firstSuccessor;
+  std::vector<uint32_t> successors;
+  std::vector<uint32_t> firstPredecessor;
+  std::vector<uint32_t> predecessors;
+
+  /// The component of each node, by graph index.
+  std::vector<uint32_t> components;
+
+  /// The level of each component, and the edge it takes its level from as
+  /// the graph indices of its source, outside the component, and target,
+  /// inside it. A component with no predecessors has no edge.
+  std::vector<uint32_t> levels;
+  std::vector<uint32_t> entrySources;
+  std::vector<uint32_t> entryTargets;
+
+  uint32_t highestLevel = 0;
+  size_t frontierCount = 0;
+};
+
+} // namespace slang::netlist
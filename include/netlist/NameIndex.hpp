@@ -0,0 +1,83 @@
+#pragma once
+
+#include "netlist/NetlistNode.hpp"
+#include "netlist/NodeTable.hpp"
+#include "netlist/SymbolReference.hpp"
+
+#include "slang/util/FlatMap.h"
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace slang::netlist {
+
+class QueryPool;
+
+/// An index of the named nodes of a netlist graph by hierarchical path.
+///
+/// Keys are the scope ids and leaves of the symbols interned in the graph's
+/// SymbolTable, so the index stores no strings of its own, and a query
+/// resolves the scope of its path through the table. Entries are split into
+/// shards by the hash of their key, and each shard keeps the nodes of a
+/// path in one contiguous range of a shard-wide array, in graph order.
+///
+/// Construction is parallel, on the graph's query pool: one pass over
+/// ranges of node table rows assigns each named row to a shard, then each
+/// shard is built by its own task. Once built, the index is immutable and
+/// may be queried from any number of threads.
+class NameIndex {
+public:
+  /// Build the index over the rows of @p table, whose symbols are interned
+  /// in @p symbols, running its tasks on @p pool. Small tables are indexed
+  /// on the calling thread.
+  NameIndex(NodeTable const &table, SymbolTable const &symbols,
+            QueryPool &pool);
+
+  /// Return the nodes with hierarchical path @p path, in graph order.
+  [[nodiscard]] auto find(std::string_view path) const
+      -> std::span<NetlistNode *const>;
+
+  /// Call @p visit with the symbol of each distinct path and its nodes, in
+  /// graph order. The order of the paths is unspecified.
+  template <typename Visit> void forEach(Visit &&visit) const {
+    for (auto const &shard : shards) {
+      for (auto const &[key, range] : shard.ranges) {
+        visit(*range.symbol, std::span<NetlistNode *const>(shard.nodes)
+                                 .subspan(range.offset, range.size));
+      }
+    }
+  }
+
+  /// Return the number of distinct paths.
+  [[nodiscard]] auto size() const -> size_t;
+
+  /// Return the number of shards.
+  [[nodiscard]] auto numShards() const -> size_t { return shards.size(); }
+
+  /// Return the node list version of the graph when the index was built.
+  [[nodiscard]] auto getVersion() const -> size_t { return version; }
+
+private:
+  struct Range {
+    SymbolReference const *symbol;
+    uint32_t offset;
+    uint32_t size;
+  };
+
+  struct Shard {
+    flat_hash_map<SymbolTable::Key, Range, SymbolTable::KeyHash> ranges;
+    std::vector<NetlistNode *> nodes;
+  };
+
+  [[nodiscard]] auto shardOf(SymbolTable::Key const &key) const -> size_t {
+    return SymbolTable::KeyHash{}(key) % shards.size();
+  }
+
+  SymbolTable const &symbols;
+  std::vector<Shard> shards;
+  size_t version;
+};
+
+} // namespace slang::netlist
@@ -31,12 +31,13 @@ private:
     case NodeKind::Port: {
       auto const &portNode = node.as<Port>();
       buffer.format("  N{} [label=\"{} port {}\"]\n", node.ID,
-                    toString(portNode.direction), portNode.name);
+                    toString(portNode.direction), portNode.symbol->name);
       break;
     }
     case NodeKind::Variable: {
       auto const &varNode = node.as<Variable>();
-      buffer.format("  N{} [label=\"Variable {}\"]\n", node.ID, varNode.name);
+      buffer.format("  N{} [label=\"Variable {}\"]\n", node.ID,
+                    varNode.symbol->name);
       break;
     }
     case NodeKind::Assignment: {
@@ -57,8 +58,8 @@ private:
     }
     case NodeKind::State: {
       auto const &state = node.as<State>();
-      buffer.format("  N{} [label=\"{} {}\"]\n", node.ID, state.name,
-                    toString(state.bounds));
+      buffer.format("  N{} [label=\"{} {}\"]\n", node.ID,
+                    state.symbol->name, toString(state.bounds));
       break;
     }
     case NodeKind::Constant: {
@@ -75,6 +76,7 @@ private:
   static void
   renderImpl(NetlistGraph const &netlist, FormatBuffer &buffer,
              std::unordered_set<NetlistNode const *> const *filter) {
+    SLANG_ASSERT(!netlist.hasReleasedEdges());
     auto included = [&](NetlistNode const &node) {
       return filter == nullptr || filter->count(&node) != 0;
     };
@@ -4,19 +4,27 @@
 #include "netlist/BuilderOptions.hpp"
 #include "netlist/Debug.hpp"
 #include "netlist/DirectedGraph.hpp"
+#include "netlist/DriverIndex.hpp"
+#include "netlist/FrozenNetlist.hpp"
+#include "netlist/HierarchyTrie.hpp"
+#include "netlist/NameIndex.hpp"
 #include "netlist/NetlistEdge.hpp"
 #include "netlist/NetlistNode.hpp"
+#include "netlist/NodeTable.hpp"
+#include "netlist/SequentialGraph.hpp"
 #include "netlist/SymbolReference.hpp"
 #include "netlist/TextLocation.hpp"
+#include "netlist/TraversalContext.hpp"
 
 #include "slang/ast/SemanticFacts.h"
 
 #include <algorithm>
+#include <memory>
+#include <mutex>
 #include <ranges>
 #include <regex>
 #include <span>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 namespace slang {
@@ -30,6 +38,8 @@ class AnalysisManager;
 
 namespace slang::netlist {
 
+class QueryPool;
+
 /// Classification of a node against a graph's black boxes.
 enum class BlackBoxCoverage {
   /// Not covered by any black box.
@@ -46,6 +56,11 @@ public:
   FileTable fileTable;
   SymbolTable symbolTable;
 
+  NetlistGraph();
+  NetlistGraph(NetlistGraph const &) = delete;
+  auto operator=(NetlistGraph const &) -> NetlistGraph & = delete;
+  ~NetlistGraph();
+
   /// Build the netlist from an elaborated compilation.
   ///
   /// Caller is responsible for having run `VisitAll`, frozen the compilation,
@@ -56,6 +71,49 @@ public:
              analysis::AnalysisManager &analysisManager,
              BuilderOptions options = {});
 
+  /// Compact the graph into a read-only compressed-sparse-row snapshot.
+  ///
+  /// While frozen, getDrivers, getBitDrivers, getCombFanOut, getCombFanIn,
+  /// getSensitivity and getConstantDrivers walk the snapshot's contiguous
+  /// arrays instead of the per-edge heap allocations, returning the same
+  /// results in the same order. getDrivers and getBitDrivers also build a
+  /// DriverIndex over the snapshot on first use, so that later lookups do
+  /// not scan the edges. The snapshot is dropped by build(), addEdge() and
+  /// unfreeze(); any other mutation of a frozen graph must be followed by
+  /// unfreeze() or another freeze().
+  ///
+  /// If @p releaseEdges is set, the pointer-based edges are then destroyed
+  /// and their arena released, so that the graph holds its edges only in
+  /// the snapshot's packed form. The nodes remain, with empty edge lists,
+  /// and unfreeze() rebuilds the edges exactly as they were. While the
+  /// edges are released, only the queries listed above, the lookups and
+  /// the batched cone queries may be used; anything that walks a node's
+  /// edges, including the bit-precise queries and the analyses built from
+  /// the graph, requires the edges, and nodes must not be added or removed.
+  void freeze(bool releaseEdges = false);
+
+  /// Drop the snapshot created by freeze(), first rebuilding the
+  /// pointer-based edges if they were released.
+  void unfreeze();
+
+  /// Return true if the graph has a current snapshot.
+  [[nodiscard]] auto isFrozen() const -> bool { return frozen != nullptr; }
+
+  /// Return true if the graph is frozen with its pointer-based edges
+  /// released, so that they exist only in the snapshot.
+  [[nodiscard]] auto hasReleasedEdges() const -> bool { return edgesReleased; }
+
+  /// Return the snapshot created by freeze(), or nullptr if not frozen.
+  [[nodiscard]] auto getFrozen() const -> FrozenNetlist const * {
+    return frozen.get();
+  }
+
+  /// Return the number of edges in the graph, counted in the snapshot if
+  /// the edges are released.
+  [[nodiscard]] auto numEdges() const -> size_t {
+    return edgesReleased ? frozen->numEdges() : DirectedGraph::numEdges();
+  }
+
   /// Lookup a node in the graph by its hierarchical name.
   ///
   /// @param name The hierarchical name of the node.
@@ -75,6 +133,10 @@ public:
   /// A driver is any node that is the source of an edge annotated with a
   /// matching symbol reference whose bounds overlap @p bounds. Each driver is
   /// reported at most once.
+  ///
+  /// On a frozen graph the query is answered from a DriverIndex in
+  /// O((k + 1) log n) time for a symbol with n driving edges, k of them
+  /// matching; otherwise it scans every edge.
   [[nodiscard]] auto getDrivers(std::string_view name,
                                 DriverBitRange bounds) const
       -> std::vector<NetlistNode *>;
@@ -110,11 +172,82 @@ public:
   [[nodiscard]] auto getCombFanOut(NetlistNode &node) const
       -> std::vector<NetlistNode *>;
 
+  /// As getCombFanOut(node), reusing the scratch storage in @p context.
+  /// Prefer this overload when running many queries in a row.
+  [[nodiscard]] auto getCombFanOut(NetlistNode &node,
+                                   TraversalContext &context) const
+      -> std::vector<NetlistNode *>;
+
   /// Return all nodes that can reach @p node via combinational edges in the
   /// backward (fan-in) direction.  The traversal stops at State nodes.
   [[nodiscard]] auto getCombFanIn(NetlistNode &node) const
       -> std::vector<NetlistNode *>;
 
+  /// As getCombFanIn(node), reusing the scratch storage in @p context.
+  [[nodiscard]] auto getCombFanIn(NetlistNode &node,
+                                  TraversalContext &context) const
+      -> std::vector<NetlistNode *>;
+
+  /// A node reached by a bit-precise traversal and the bits of it reached.
+  struct BitNode {
+    NetlistNode *node;
+    /// The bits reached of a Port, Variable or State node, as disjoint
+    /// ranges in ascending order. Empty for an operation node, which has
+    /// no bits of its own.
+    std::vector<DriverBitRange> bits;
+  };
+
+  /// Return the nodes reachable from bits @p bits of @p node via
+  /// combinational edges in the forward (fan-out) direction, with the bits
+  /// of each that are reached. Unlike getCombFanOut(node), an edge is only
+  /// followed if the symbol and bounds annotating it carry some of the bits
+  /// reached at its source, so the cone of one bit of a bus excludes the
+  /// logic reading only its other bits. Bits are mapped across port
+  /// connections by aligning the bounds of the edge with those of the
+  /// port. An operation node passes every bit annotating its out-edges on.
+  /// The traversal stops at State nodes. The nodes are in the order they
+  /// are first reached, starting with @p node.
+  [[nodiscard]] auto getCombFanOut(NetlistNode &node,
+                                   DriverBitRange bits) const
+      -> std::vector<BitNode>;
+
+  /// As getCombFanOut(node, bits), in the backward (fan-in) direction: the
+  /// nodes and bits that can reach bits @p bits of @p node.
+  [[nodiscard]] auto getCombFanIn(NetlistNode &node, DriverBitRange bits) const
+      -> std::vector<BitNode>;
+
+  /// Return the combinational fan-out of each node in @p sources: entry i
+  /// holds the nodes getCombFanOut(*sources[i]) would, but in graph order.
+  ///
+  /// The cones are computed together rather than by one traversal per
+  /// source. The subgraph reachable from any source is collected once and
+  /// condensed into its strongly connected components, then each sweep
+  /// propagates a bit mask of up to 256 sources along the edges between
+  /// components in topological order, so overlapping cones share the work.
+  /// The members of a combinational loop share one mask, so a single pass
+  /// settles every cone.
+  [[nodiscard]] auto
+  getCombFanOutMany(std::span<NetlistNode *const> sources) const
+      -> std::vector<std::vector<NetlistNode *>>;
+
+  /// As getCombFanOutMany, in the backward (fan-in) direction of
+  /// getCombFanIn.
+  [[nodiscard]] auto
+  getCombFanInMany(std::span<NetlistNode *const> sources) const
+      -> std::vector<std::vector<NetlistNode *>>;
+
+  /// Return the number of nodes in the combinational fan-out of each node
+  /// in @p sources, computed as getCombFanOutMany does without listing the
+  /// members.
+  [[nodiscard]] auto
+  getCombFanOutCounts(std::span<NetlistNode *const> sources) const
+      -> std::vector<size_t>;
+
+  /// As getCombFanOutCounts, in the backward (fan-in) direction.
+  [[nodiscard]] auto
+  getCombFanInCounts(std::span<NetlistNode *const> sources) const
+      -> std::vector<size_t>;
+
   /// A clock/reset signal driving a State node, paired with its edge kind.
   struct SensitivitySource {
     NetlistNode *source;
@@ -129,6 +262,11 @@ public:
   [[nodiscard]] auto getSensitivity(NetlistNode &node) const
       -> std::vector<SensitivitySource>;
 
+  /// As getSensitivity(node), reusing the scratch storage in @p context.
+  [[nodiscard]] auto getSensitivity(NetlistNode &node,
+                                    TraversalContext &context) const
+      -> std::vector<SensitivitySource>;
+
   /// Return the Constant nodes feeding @p node if its combinational fan-in
   /// bottoms out only at Constants (i.e. the sink is tied off to literal
   /// values). Returns an empty vector if any non-constant source reaches
@@ -138,9 +276,17 @@ public:
   ///
   /// Variables, Assignments, Conditionals, Cases, Merges, and driven Ports
   /// in the fan-in are treated as pass-throughs.
+  ///
+  /// To classify every node of the graph, build a ConstantDriverMap, which
+  /// computes the same sets for all nodes in one pass.
   [[nodiscard]] auto getConstantDrivers(NetlistNode &node) const
       -> std::vector<NetlistNode *>;
 
+  /// As getConstantDrivers(node), reusing the scratch storage in @p context.
+  [[nodiscard]] auto getConstantDrivers(NetlistNode &node,
+                                        TraversalContext &context) const
+      -> std::vector<NetlistNode *>;
+
   /// Find named nodes whose hierarchical path matches the glob @p pattern.
   ///
   /// Supported wildcards:
@@ -148,28 +294,93 @@ public:
   ///              (does not cross `.`).
   ///   `**`, `...`  zero or more characters including `.` (recursive).
   ///   `?`        exactly one character within a single path segment.
+  ///
+  /// The pattern is matched a segment at a time against the hierarchy
+  /// trie, so only the subtrees it can match are visited. Nodes are
+  /// returned in a pre-order walk of the hierarchy.
   [[nodiscard]] auto findNodes(std::string_view pattern) const
       -> std::vector<NetlistNode *>;
 
+  /// Find named nodes whose hierarchical path is @p scope or lies below
+  /// it (see pathInScope), in a pre-order walk of the hierarchy.
+  [[nodiscard]] auto findNodesInScope(std::string_view scope) const
+      -> std::vector<NetlistNode *>;
+
   /// Find named nodes whose hierarchical path matches the regex @p pattern.
-  [[nodiscard]] auto findNodesRegex(std::string_view pattern) const
+  ///
+  /// Large candidate lists are matched on a thread pool owned by the graph,
+  /// created on first use with the build profile's thread count. Pass
+  /// @p parallel as false to match on the calling thread, for instance from
+  /// a task that is already running on a pool of its own.
+  [[nodiscard]] auto findNodesRegex(std::string_view pattern,
+                                    bool parallel = true) const
       -> std::vector<NetlistNode *>;
 
-  /// Return a view of all nodes of the specified kind.
+  /// Return all nodes of the specified kind, in graph order.
   ///
   /// @param kind The kind of nodes to filter.
-  /// @return A view of nodes matching the specified kind.
-  [[nodiscard]]
-  auto filterNodes(NodeKind kind) const {
-    return nodes |
-           std::views::filter([kind](std::unique_ptr<NetlistNode> const &p) {
-             return p->kind == kind;
-           });
+  /// @return The nodes matching the specified kind, selected by a scan of
+  /// the node table's kind column.
+  [[nodiscard]] auto filterNodes(NodeKind kind) const
+      -> std::vector<NetlistNode *> {
+    return getNodeTable().filter(kind);
   }
 
+  /// Return the struct-of-arrays table of node attributes (kind, bounds,
+  /// location and symbol, indexed by graph index). The table is built on
+  /// first use and rebuilt after nodes are added or removed. Safe to call
+  /// from several threads at once, but not concurrently with graph
+  /// mutation.
+  [[nodiscard]] auto getNodeTable() const -> NodeTable const &;
+
+  /// Return the index of named nodes by hierarchical path that backs
+  /// lookup(), findNodes() and findNodesRegex(). Like the node table, the
+  /// index is built in parallel on first use and rebuilt after nodes are
+  /// added or removed, once even when several threads query at the same
+  /// time.
+  [[nodiscard]] auto getNameIndex() const -> NameIndex const &;
+
+  /// Return the trie of hierarchical path segments that backs findNodes()
+  /// and findNodesInScope(). Like the name index, it is built on first use
+  /// and rebuilt after nodes are added or removed.
+  [[nodiscard]] auto getHierarchyTrie() const -> HierarchyTrie const &;
+
+  /// Build the indexes that lookups otherwise build on first use: the node
+  /// table, the name index, the hierarchy trie and, if the graph is frozen,
+  /// the driver index. Call it before running queries from several threads,
+  /// so that they do not all wait on the first one to need each index.
+  void buildIndexes() const;
+
+  /// Return the register-to-register abstraction of the graph, whose nodes
+  /// are its State nodes and top-level ports (see SequentialGraph). It is
+  /// built in parallel on first use and rebuilt after nodes are added or
+  /// removed; edges added between existing nodes are not picked up.
+  [[nodiscard]] auto getSequentialGraph() const -> SequentialGraph const &;
+
+  /// Return the worker threads shared by findNodesRegex, the name index,
+  /// the sequential graph and the analyses built over the graph, created
+  /// on first use with the thread count of the last build.
+  [[nodiscard]] auto getQueryPool() const -> QueryPool &;
+
+  /// Contract pass-through nodes: Assignment and Merge nodes, and
+  /// Conditional nodes with a single input. Each contracted node is
+  /// replaced by edges from each of its sources directly to each of its
+  /// targets, and removed. Return the number of nodes removed.
+  ///
+  /// Edge annotations are carried over: a replacement edge keeps the
+  /// symbol, bounds and edge kind of the incoming and outgoing edges it
+  /// replaces (as parallel edges when both are annotated), so queries on
+  /// the remaining nodes give the same results, except that a removed
+  /// node reported as a driver is replaced by its own sources. A node is
+  /// left in place if it has no inputs or no outputs, has a disabled or
+  /// self edge, has a clock-sensitive input, or if contracting it would
+  /// increase the number of edges.
+  auto contractPassThroughNodes() -> size_t;
+
   /// Add an edge between two nodes.
   auto addEdge(NetlistNode &sourceNode, NetlistNode &targetNode)
       -> NetlistEdge & {
+    unfreeze();
     return sourceNode.addEdge(targetNode);
   }
 
@@ -178,8 +389,10 @@ public:
     return buildProfile;
   }
 
-  /// Set the profiling data (called internally by NetlistBuilder).
-  void setBuildProfile(BuildProfile const &profile) { buildProfile = profile; }
+  /// Set the profiling data (called internally by NetlistBuilder). This
+  /// drops the query pool, which is recreated with the new thread count on
+  /// next use.
+  void setBuildProfile(BuildProfile const &profile);
 
   /// Record the hierarchical path of a black-boxed instance.
   void addBlackBoxPath(std::string path) {
@@ -203,9 +416,46 @@ public:
 private:
   BuildProfile buildProfile;
   std::vector<std::string> blackBoxPaths;
-  mutable bool indexBuilt = false;
-  mutable std::unordered_map<std::string, std::vector<NetlistNode *>> nodeIndex;
-  void buildIndex() const;
+  std::unique_ptr<FrozenNetlist> frozen;
+  bool edgesReleased = false;
+  mutable std::unique_ptr<DriverIndex> driverIndex;
+  mutable std::mutex lazyMutex;
+  mutable std::unique_ptr<NodeTable> nodeTable;
+  mutable std::unique_ptr<NameIndex> nameIndex;
+  mutable std::unique_ptr<HierarchyTrie> hierarchyTrie;
+  mutable std::unique_ptr<SequentialGraph> sequentialGraph;
+  mutable std::unique_ptr<QueryPool> queryPool;
+
+  /// Return the query pool, creating it on first use. The caller holds
+  /// lazyMutex.
+  [[nodiscard]] auto getQueryPoolLocked() const -> QueryPool &;
+
+  /// Return the node table, rebuilding it if it is out of date. The caller
+  /// holds lazyMutex.
+  [[nodiscard]] auto getNodeTableLocked() const -> NodeTable const &;
+
+  /// Return the name index, rebuilding it if it is out of date. The caller
+  /// holds lazyMutex.
+  [[nodiscard]] auto getNameIndexLocked() const -> NameIndex const &;
+
+  /// Return the driver index of the snapshot, building it on first use.
+  /// Requires the graph to be frozen.
+  [[nodiscard]] auto getDriverIndex() const -> DriverIndex const &;
+
+  /// Return the snapshot index of @p node, or FrozenNetlist::null_index if
+  /// the graph is not frozen.
+  [[nodiscard]] auto frozenIndex(NetlistNode const &node) const
+      -> FrozenNetlist::NodeIndex {
+    return frozen ? frozen->getIndex(node) : FrozenNetlist::null_index;
+  }
+
+  /// Rebuild the pointer-based edges from the snapshot after they were
+  /// released by freeze().
+  void restoreEdges();
+
+  [[nodiscard]] auto getFrozenSensitivity(FrozenNetlist::NodeIndex start,
+                                          TraversalContext &context) const
+      -> std::vector<SensitivitySource>;
 };
 
 } // namespace slang::netlist
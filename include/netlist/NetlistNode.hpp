@@ -9,6 +9,7 @@
 #include "netlist/DirectedGraph.hpp"
 #include "netlist/DriverBitRange.hpp"
 #include "netlist/NetlistEdge.hpp"
+#include "netlist/SymbolReference.hpp"
 #include "netlist/TextLocation.hpp"
 
 #include "slang/ast/SemanticFacts.h"
@@ -52,7 +53,7 @@ public:
     return const_cast<T &>(*(static_cast<const T *>(this)));
   }
 
-  virtual auto getHierarchicalPath() const -> std::optional<std::string_view> {
+  virtual auto getHierarchicalPath() const -> std::optional<std::string> {
     return std::nullopt;
   }
 
@@ -70,16 +71,16 @@ private:
 
 class Port : public NetlistNode {
 public:
-  std::string name;
-  std::string hierarchicalPath;
+  /// The port's name and hierarchical path, interned in the graph's
+  /// SymbolTable.
+  SymbolReference const *symbol;
   TextLocation location;
   ast::ArgumentDirection direction;
   DriverBitRange bounds;
 
-  Port(std::string name, std::string hierarchicalPath, TextLocation location,
+  Port(SymbolReference const *symbol, TextLocation location,
        ast::ArgumentDirection direction, DriverBitRange bounds)
-      : NetlistNode(NodeKind::Port), name(std::move(name)),
-        hierarchicalPath(std::move(hierarchicalPath)), location(location),
+      : NetlistNode(NodeKind::Port), symbol(symbol), location(location),
         direction(direction), bounds(std::move(bounds)) {}
 
   static auto isKind(NodeKind otherKind) -> bool {
@@ -92,8 +93,8 @@ public:
   /// Return true if any other node drives this port.
   auto isDriven() const -> bool { return inDegree() > 0; }
 
-  auto getHierarchicalPath() const -> std::optional<std::string_view> override {
-    return hierarchicalPath;
+  auto getHierarchicalPath() const -> std::optional<std::string> override {
+    return symbol->getHierarchicalPath();
   }
 
   auto getBounds() const -> std::optional<DriverBitRange> override {
@@ -107,23 +108,23 @@ public:
 
 class Variable : public NetlistNode {
 public:
-  std::string name;
-  std::string hierarchicalPath;
+  /// The variable's name and hierarchical path, interned in the graph's
+  /// SymbolTable.
+  SymbolReference const *symbol;
   TextLocation location;
   DriverBitRange bounds;
 
-  Variable(std::string name, std::string hierarchicalPath,
-           TextLocation location, DriverBitRange bounds)
-      : NetlistNode(NodeKind::Variable), name(std::move(name)),
-        hierarchicalPath(std::move(hierarchicalPath)), location(location),
+  Variable(SymbolReference const *symbol, TextLocation location,
+           DriverBitRange bounds)
+      : NetlistNode(NodeKind::Variable), symbol(symbol), location(location),
         bounds(std::move(bounds)) {}
 
   static auto isKind(NodeKind otherKind) -> bool {
     return otherKind == NodeKind::Variable;
   }
 
-  auto getHierarchicalPath() const -> std::optional<std::string_view> override {
-    return hierarchicalPath;
+  auto getHierarchicalPath() const -> std::optional<std::string> override {
+    return symbol->getHierarchicalPath();
   }
 
   auto getBounds() const -> std::optional<DriverBitRange> override {
@@ -137,23 +138,23 @@ public:
 
 class State : public NetlistNode {
 public:
-  std::string name;
-  std::string hierarchicalPath;
+  /// The state's name and hierarchical path, interned in the graph's
+  /// SymbolTable.
+  SymbolReference const *symbol;
   TextLocation location;
   DriverBitRange bounds;
 
-  State(std::string name, std::string hierarchicalPath, TextLocation location,
+  State(SymbolReference const *symbol, TextLocation location,
         DriverBitRange bounds)
-      : NetlistNode(NodeKind::State), name(std::move(name)),
-        hierarchicalPath(std::move(hierarchicalPath)), location(location),
+      : NetlistNode(NodeKind::State), symbol(symbol), location(location),
         bounds(std::move(bounds)) {}
 
   static auto isKind(NodeKind otherKind) -> bool {
     return otherKind == NodeKind::State;
   }
 
-  auto getHierarchicalPath() const -> std::optional<std::string_view> override {
-    return hierarchicalPath;
+  auto getHierarchicalPath() const -> std::optional<std::string> override {
+    return symbol->getHierarchicalPath();
   }
 
   auto getBounds() const -> std::optional<DriverBitRange> override {
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "netlist/DirectedGraph.hpp"
+#include "netlist/DriverBitRange.hpp"
+#include "netlist/NetlistEdge.hpp"
+#include "netlist/NetlistNode.hpp"
+#include "netlist/SymbolReference.hpp"
+#include "netlist/TextLocation.hpp"
+
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace slang::netlist {
+
+/// A struct-of-arrays table of the attributes of every node in a netlist
+/// graph.
+///
+/// Row @c i describes the node with graph index @c i, and each attribute is
+/// held in its own contiguous column, so a scan over one attribute of the
+/// whole graph (for example, selecting the State nodes or matching paths)
+/// streams through a single array without dereferencing nodes or making
+/// virtual calls. Columns are exposed as spans so that scans can be split
+/// into index ranges across threads.
+///
+/// Nodes without a symbol (the operation nodes) have a null symbol and
+/// empty bounds; Merge nodes also have an empty location.
+///
+/// The table is a copy of the node attributes and is invalidated when nodes
+/// are added to or removed from the graph it was built from;
+/// NetlistGraph::getNodeTable() rebuilds it on demand.
+class NodeTable {
+public:
+  explicit NodeTable(DirectedGraph<NetlistNode, NetlistEdge> const &graph);
+
+  /// Return the number of rows, which is the number of nodes in the graph.
+  [[nodiscard]] auto size() const -> size_t { return nodes.size(); }
+
+  /// Return the node list version of the graph when the table was built.
+  [[nodiscard]] auto getVersion() const -> size_t { return version; }
+
+  [[nodiscard]] auto getNode(size_t index) const -> NetlistNode & {
+    return *nodes[index];
+  }
+  [[nodiscard]] auto getID(size_t index) const -> size_t { return ids[index]; }
+  [[nodiscard]] auto getKind(size_t index) const -> NodeKind {
+    return kinds[index];
+  }
+  [[nodiscard]] auto getBounds(size_t index) const -> DriverBitRange {
+    return bounds[index];
+  }
+  [[nodiscard]] auto getLocation(size_t index) const -> TextLocation const & {
+    return locations[index];
+  }
+  [[nodiscard]] auto getSymbol(size_t index) const
+      -> SymbolReference const * {
+    return symbols[index];
+  }
+
+  /// Return the hierarchical path of the node in row @p index, if it has
+  /// one. Equivalent to NetlistNode::getHierarchicalPath().
+  [[nodiscard]] auto getPath(size_t index) const
+      -> std::optional<std::string> {
+    if (symbols[index] == nullptr) {
+      return std::nullopt;
+    }
+    return symbols[index]->getHierarchicalPath();
+  }
+
+  // Whole columns, indexed by graph index.
+
+  [[nodiscard]] auto getKinds() const -> std::span<NodeKind const> {
+    return kinds;
+  }
+  [[nodiscard]] auto getSymbols() const
+      -> std::span<SymbolReference const *const> {
+    return symbols;
+  }
+  [[nodiscard]] auto getAllBounds() const -> std::span<DriverBitRange const> {
+    return bounds;
+  }
+
+  /// Return the nodes of kind @p kind, in graph order.
+  [[nodiscard]] auto filter(NodeKind kind) const -> std::vector<NetlistNode *>;
+
+private:
+  size_t version;
+  std::vector<NetlistNode *> nodes;
+  std::vector<size_t> ids;
+  std::vector<NodeKind> kinds;
+  std::vector<DriverBitRange> bounds;
+  std::vector<TextLocation> locations;
+  std::vector<SymbolReference const *> symbols;
+};
+
+} // namespace slang::netlist
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "netlist/NetlistNode.hpp"
+#include "netlist/NetlistPath.hpp"
+#include "netlist/TraversalContext.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace slang::netlist {
+
+/// Limits on the paths reported by a PathEnumerator. Zero means no limit.
+struct PathLimits {
+  /// The maximum number of paths to report.
+  size_t maxPaths = 0;
+
+  /// The maximum number of edges in a path.
+  size_t maxDepth = 0;
+
+  /// The maximum time to spend, counted from the construction of the
+  /// enumerator.
+  std::chrono::milliseconds timeLimit{0};
+};
+
+/// Enumerate the simple paths between two nodes of a netlist, one at a
+/// time.
+///
+/// The enumerator first finds the distance to the end node of every node
+/// that reaches it, with one breadth-first search backward from the end.
+/// A depth-first search from the start then only steps to nodes that can
+/// still reach the end within the depth limit, trying the nearest first,
+/// so the first path reported is a shortest one. The distances ignore the
+/// nodes already on the path, so a branch can still fail when every way
+/// on to the end passes back through the path. The search holds only the
+/// current path and the untried successors along it, and each call to next
+/// resumes it where the last one stopped, so the memory used does not grow
+/// with the number of paths. Both searches count against the time limit.
+///
+/// The enumerator refers to the nodes of the graph, which must not change
+/// while it is in use.
+class PathEnumerator {
+public:
+  /// The state of the enumeration.
+  enum class Status {
+    /// More paths may follow.
+    Running,
+    /// Every path has been reported.
+    Exhausted,
+    /// The limit on the number of paths was reached.
+    PathLimit,
+    /// The time limit expired.
+    TimeLimit,
+  };
+
+  /// Enumerate the paths from @p startNode to @p endNode within @p limits.
+  /// If @p combinational is true, only paths that do not pass through
+  /// State nodes are reported, as by PathFinder::findComb.
+  PathEnumerator(NetlistNode &startNode, NetlistNode &endNode,
+                 PathLimits limits = {}, bool combinational = false);
+
+  /// Return the next path, or nothing once the paths are exhausted or a
+  /// limit has been reached. A path visits no node more than once, and
+  /// there are none from a node to itself.
+  auto next() -> std::optional<NetlistPath>;
+
+  /// Return the state of the enumeration.
+  [[nodiscard]] auto getStatus() const -> Status { return status; }
+
+  /// Return the number of paths reported so far.
+  [[nodiscard]] auto numPaths() const -> size_t { return pathCount; }
+
+private:
+  /// A node on the current path and the range of its successors in
+  /// candidates, of which those from next onward are untried.
+  struct Frame {
+    NetlistNode *node;
+    uint32_t first;
+    uint32_t next;
+    uint32_t last;
+  };
+
+  auto follows(NetlistEdge const &edge) const -> bool;
+  void push(NetlistNode &node);
+  void pop();
+  auto timedOut() const -> bool;
+
+  NetlistNode &endNode;
+  PathLimits limits;
+  bool combinational;
+  std::chrono::steady_clock::time_point deadline;
+  Status status = Status::Running;
+  size_t pathCount = 0;
+  uint32_t steps = 0;
+
+  /// The nodes that reach the end, and the distance of each from it, by
+  /// graph index.
+  TraversalContext reachesEnd;
+  std::vector<uint32_t> distances;
+
+  /// The current path, and whether each node is on it by graph index.
+  std::vector<Frame> stack;
+  std::vector<uint8_t> onPath;
+
+  /// The successors of the nodes on the path, nearest to the end first.
+  std::vector<NetlistNode *> candidates;
+};
+
+} // namespace slang::netlist
@@ -2,17 +2,45 @@
 
 #include "netlist/NetlistGraph.hpp"
 #include "netlist/NetlistPath.hpp"
+#include "netlist/TraversalContext.hpp"
+
+#include <vector>
 
 namespace slang::netlist {
 
-/// Find a path between two points in a netlist using a depth-first
-/// search.
+/// Find a path between two points in a netlist. The traversal scratch
+/// storage is kept between calls, so reusing one PathFinder for a series of
+/// queries avoids reallocating it.
 class PathFinder {
 public:
+  /// How the graph is searched for a path.
+  enum class Mode {
+    /// A depth-first search from the start, returning the first path it
+    /// finds, which may be long.
+    DepthFirst,
+    /// A breadth-first search from the start, returning a path with the
+    /// fewest edges and stopping as soon as the end is reached.
+    Shortest,
+    /// Breadth-first searches forward from the start and backward from the
+    /// end, a level at a time from whichever side has the smaller frontier,
+    /// until they meet. Returns a path with the fewest edges, usually
+    /// visiting far fewer nodes than a search from one end.
+    Bidirectional,
+  };
+
   PathFinder() = default;
 
+  explicit PathFinder(Mode mode) : mode(mode) {}
+
+  /// Return the search mode.
+  [[nodiscard]] auto getMode() const -> Mode { return mode; }
+
+  /// Set the search mode of later queries.
+  void setMode(Mode newMode) { mode = newMode; }
+
   /// Find a path between two nodes in the netlist.
-  /// Returns an empty NetlistPath if the path does not exist.
+  /// Returns an empty NetlistPath if the path does not exist, or if the two
+  /// nodes are the same.
   auto find(NetlistNode &startNode, NetlistNode &endNode) -> NetlistPath;
 
   /// Find a combinatorial path between two nodes in the netlist.
@@ -20,6 +48,52 @@ public:
   /// state elements). Returns an empty NetlistPath if no combinatorial
   /// path exists.
   auto findComb(NetlistNode &startNode, NetlistNode &endNode) -> NetlistPath;
+
+  /// Find a path from bits @p bits of @p startNode to @p endNode along
+  /// which every edge carries some of the bits reached at its source, as
+  /// NetlistGraph::getCombFanOut(node, bits) traces them. The search is
+  /// breadth-first over the bit ranges reached, whatever the mode. Returns
+  /// an empty NetlistPath if no such path exists, or if the two nodes are
+  /// the same.
+  auto find(NetlistNode &startNode, DriverBitRange bits, NetlistNode &endNode)
+      -> NetlistPath;
+
+  /// As find(startNode, bits, endNode), for a combinatorial path.
+  auto findComb(NetlistNode &startNode, DriverBitRange bits,
+                NetlistNode &endNode) -> NetlistPath;
+
+private:
+  template <class EdgePredicate>
+  auto search(NetlistNode &startNode, NetlistNode &endNode) -> NetlistPath;
+
+  template <class EdgePredicate>
+  auto searchBreadthFirst(NetlistNode &startNode, NetlistNode &endNode)
+      -> NetlistPath;
+
+  template <class EdgePredicate>
+  auto searchBidirectional(NetlistNode &startNode, NetlistNode &endNode)
+      -> NetlistPath;
+
+  /// Return the path from @p startNode to @p endNode through the parents
+  /// recorded by the forward search.
+  auto buildPath(NetlistNode &startNode, NetlistNode &endNode) -> NetlistPath;
+
+  Mode mode = Mode::DepthFirst;
+
+  /// The nodes visited forward from the start, and the parent of each, by
+  /// graph index. A parent is only valid for a visited node.
+  TraversalContext context;
+  std::vector<NetlistNode *> parents;
+
+  /// The nodes visited backward from the end by a bidirectional search,
+  /// and the next node toward the end of each.
+  TraversalContext backwardContext;
+  std::vector<NetlistNode *> children;
+
+  /// The levels of the breadth-first searches.
+  std::vector<NetlistNode *> frontier;
+  std::vector<NetlistNode *> backwardFrontier;
+  std::vector<NetlistNode *> nextFrontier;
 };
 
 } // namespace slang::netlist
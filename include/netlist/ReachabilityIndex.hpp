@@ -0,0 +1,104 @@
+#pragma once
+
+#include "netlist/NetlistGraph.hpp"
+#include "netlist/NetlistNode.hpp"
+#include "netlist/NetlistPath.hpp"
+#include "netlist/TraversalContext.hpp"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace slang::netlist {
+
+/// An index of combinational reachability in a netlist graph: whether one
+/// node reaches another through enabled edges that do not enter a State
+/// node, which is the question PathFinder::findComb answers by searching.
+///
+/// Construction collapses the strongly connected components of the
+/// combinational graph (its loops) into a condensation DAG and labels each
+/// component with its position in a few depth-first traversals of the DAG.
+/// A query compares the labels of the two components: the interval labels
+/// of a component contain those of every component it reaches, so most
+/// negative answers are immediate, and a target inside a component's
+/// depth-first subtree is an immediate positive. The remaining queries
+/// search the DAG from the source, skipping every component whose labels
+/// rule out the target.
+///
+/// The index refers to the graph it was built from and is invalidated by
+/// any change to its nodes or edges. It may be queried from any number of
+/// threads, each with its own TraversalContext.
+class ReachabilityIndex {
+public:
+  explicit ReachabilityIndex(NetlistGraph const &graph);
+
+  /// Return true if @p from reaches @p to through combinational edges. A
+  /// node reaches itself.
+  [[nodiscard]] auto reaches(NetlistNode const &from,
+                             NetlistNode const &to) const -> bool;
+
+  /// As reaches(from, to), using the scratch storage in @p context for the
+  /// queries that search the DAG.
+  [[nodiscard]] auto reaches(NetlistNode const &from, NetlistNode const &to,
+                             TraversalContext &context) const -> bool;
+
+  /// Return a combinational path from @p from to @p to, or an empty path if
+  /// there is none. The path is reconstructed by a search of the graph that
+  /// only enters nodes the labels do not rule out.
+  [[nodiscard]] auto findPath(NetlistNode &from, NetlistNode &to) const
+      -> NetlistPath;
+
+  /// As findPath(from, to), reusing the scratch storage in @p context.
+  [[nodiscard]] auto findPath(NetlistNode &from, NetlistNode &to,
+                              TraversalContext &context) const -> NetlistPath;
+
+  /// Return the number of strongly connected components of the
+  /// combinational graph, each of which is one node of the DAG.
+  [[nodiscard]] auto numComponents() const -> size_t { return labels.size(); }
+
+  /// Return the component of @p node. Nodes in the same component are on
+  /// a combinational loop together.
+  [[nodiscard]] auto getComponent(NetlistNode const &node) const -> uint32_t {
+    return components[node.getGraphIndex()];
+  }
+
+private:
+  /// Number of depth-first traversals of the DAG labelling each component.
+  static constexpr size_t numTraversals = 2;
+
+  /// The position of a component in one traversal: its pre-order and
+  /// post-order numbers, and the lowest post-order number among the
+  /// components it reaches.
+  struct Label {
+    uint32_t pre;
+    uint32_t post;
+    uint32_t low;
+  };
+
+  /// Return false if the labels show that component @p from cannot reach
+  /// component @p to.
+  [[nodiscard]] auto mayReach(uint32_t from, uint32_t to) const -> bool;
+
+  /// Return true if the labels show that component @p from reaches
+  /// component @p to.
+  [[nodiscard]] auto mustReach(uint32_t from, uint32_t to) const -> bool;
+
+  NetlistGraph const &graph;
+
+  /// The combinational successors of each node, by graph index, in
+  /// compressed sparse row form.
+  std::vector<uint32_t> firstSuccessor;
+  std::vector<uint32_t> successors;
+
+  /// The component of each node, by graph index. Components are numbered
+  /// so that a component only reaches components with lower numbers.
+  std::vector<uint32_t> components;
+
+  /// The successors of each component in the DAG.
+  std::vector<uint32_t> firstDagSuccessor;
+  std::vector<uint32_t> dagSuccessors;
+
+  std::vector<std::array<Label, numTraversals>> labels;
+};
+
+} // namespace slang::netlist
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "netlist/NetlistNode.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace slang::netlist {
+
+class NetlistGraph;
+class QueryPool;
+
+/// The register-to-register abstraction of a netlist graph.
+///
+/// Its nodes are the State nodes of the graph and the Port nodes of the
+/// top-level modules (those whose hierarchical path has a single `.`),
+/// and it has an edge from X to Y if a path of combinational edges leads
+/// from X to Y: enabled edges through non-State nodes, ending in a data
+/// edge (one with no clock edge kind) into Y if Y is a State node. A State
+/// node that feeds itself has an edge to itself. Paths continue through
+/// top-level Port nodes, so a port that is read internally does not hide
+/// the State nodes beyond it.
+///
+/// The graph is built with one search per node, run in parallel, and is
+/// orders of magnitude smaller than the netlist, so sequential analyses
+/// such as pipeline depth or clock-domain crossings can work on it
+/// directly.
+class SequentialGraph {
+public:
+  using NodeIndex = uint32_t;
+
+  static constexpr NodeIndex null_index = std::numeric_limits<uint32_t>::max();
+
+  /// Build the graph over @p graph, running its searches on @p pool.
+  SequentialGraph(NetlistGraph const &graph, QueryPool &pool);
+
+  /// Return the number of nodes.
+  [[nodiscard]] auto numNodes() const -> size_t { return nodes.size(); }
+
+  /// Return the number of edges.
+  [[nodiscard]] auto numEdges() const -> size_t { return targets.size(); }
+
+  /// Return the netlist node of node @p index. Nodes are in graph order.
+  [[nodiscard]] auto getNode(NodeIndex index) const -> NetlistNode & {
+    SLANG_ASSERT(isCurrent());
+    return *nodes[index];
+  }
+
+  /// Return the index of @p node, or @c null_index if it is not a node of
+  /// this graph.
+  [[nodiscard]] auto getIndex(NetlistNode const &node) const -> NodeIndex;
+
+  /// Return the nodes that node @p index reaches, in ascending order.
+  [[nodiscard]] auto successors(NodeIndex index) const
+      -> std::span<NodeIndex const> {
+    return std::span<NodeIndex const>(targets).subspan(
+        firstTarget[index], firstTarget[index + 1] - firstTarget[index]);
+  }
+
+  /// Return the nodes that reach node @p index, in ascending order.
+  [[nodiscard]] auto predecessors(NodeIndex index) const
+      -> std::span<NodeIndex const> {
+    return std::span<NodeIndex const>(sources).subspan(
+        firstSource[index], firstSource[index + 1] - firstSource[index]);
+  }
+
+  /// Return the node list version of the netlist when the graph was built.
+  [[nodiscard]] auto getVersion() const -> size_t { return version; }
+
+  /// Return true if @p node is a node of the sequential graph of a netlist:
+  /// a State node or a top-level Port node.
+  static auto isEndpoint(NetlistNode const &node) -> bool;
+
+private:
+  /// Return true if the netlist still has the nodes the graph was built
+  /// over.
+  [[nodiscard]] auto isCurrent() const -> bool;
+
+  NetlistGraph const &netlist;
+  std::vector<NetlistNode *> nodes;
+
+  /// The index of each node in @c nodes, by netlist graph index, or
+  /// @c null_index.
+  std::vector<NodeIndex> indices;
+
+  /// The successors of node n are targets[firstTarget[n]] up to
+  /// targets[firstTarget[n + 1]], and its predecessors likewise in
+  /// sources.
+  std::vector<uint32_t> firstTarget;
+  std::vector<NodeIndex> targets;
+  std::vector<uint32_t> firstSource;
+  std::vector<NodeIndex> sources;
+
+  size_t version;
+};
+
+} // namespace slang::netlist
@@ -1,10 +1,14 @@
 #pragma once
 
+#include <cstdint>
+#include <cstring>
 #include <deque>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include "netlist/TextLocation.hpp"
 
@@ -12,61 +16,244 @@
 
 namespace slang::netlist {
 
+/// A scope of the design hierarchy: the hierarchical path of a symbol
+/// without its last `.`-separated segment. Scopes form a tree interned by
+/// a SymbolTable, so the path of a scope is stored once for all the symbols
+/// and subscopes below it.
+struct SymbolScope {
+  /// The enclosing scope, or nullptr for the root scope.
+  SymbolScope const *parent;
+  /// The last segment of the scope's path. Empty for the root scope.
+  std::string_view segment;
+  /// The scope's full path. Empty for the root scope.
+  std::string_view path;
+  /// Dense identifier, in order of interning; the root scope is 0.
+  uint32_t id;
+  /// The number of segments in the path.
+  uint32_t depth;
+};
+
 /// Extracted identity of an AST symbol, decoupled from the slang AST.
+///
+/// A symbol is identified by the scope that contains it and the last
+/// segment of its hierarchical path, its leaf. The strings are views into
+/// the storage of the SymbolTable that interned the record, so a
+/// SymbolReference is only valid for the table's lifetime.
 struct SymbolReference {
-  std::string name;
-  std::string hierarchicalPath;
+  std::string_view name;
+  SymbolScope const *scope = nullptr;
+  std::string_view leaf;
   TextLocation location;
 
-  SymbolReference() = default;
-  SymbolReference(std::string name, std::string hierarchicalPath,
-                  TextLocation location)
-      : name(std::move(name)), hierarchicalPath(std::move(hierarchicalPath)),
-        location(location) {}
-
   auto empty() const -> bool { return name.empty(); }
+
+  /// Return the hierarchical path, joined from the scope path and the leaf.
+  auto getHierarchicalPath() const -> std::string {
+    std::string path;
+    appendHierarchicalPath(path);
+    return path;
+  }
+
+  /// Append the hierarchical path to @p out, reusing its capacity.
+  void appendHierarchicalPath(std::string &out) const {
+    if (scope != nullptr && !scope->path.empty()) {
+      out.append(scope->path);
+      out.push_back('.');
+    }
+    out.append(leaf);
+  }
+
+  /// Return true if the hierarchical path is @p path, without building it.
+  auto hasPath(std::string_view path) const -> bool {
+    if (scope == nullptr || scope->path.empty()) {
+      return path == leaf;
+    }
+    return path.size() == scope->path.size() + 1 + leaf.size() &&
+           path.starts_with(scope->path) && path[scope->path.size()] == '.' &&
+           path.ends_with(leaf);
+  }
 };
 
-/// Centralised table of unique SymbolReference records, keyed by
-/// hierarchicalPath. Returned pointers are stable for the table's lifetime
-/// and may be shared across many NetlistEdge instances. Lookups are
-/// lock-free; insertion takes a mutex.
+/// Centralised table of unique SymbolReference records, keyed by scope and
+/// leaf. Returned pointers are stable for the table's lifetime and may be
+/// shared across many NetlistEdge instances and Port, Variable and State
+/// nodes, which hold a pointer rather than their own copies of the strings.
+/// Lookups are lock-free; insertion takes a mutex.
+///
+/// A path is split at its last `.` into a scope path and a leaf. Scopes are
+/// interned as a tree, each storing its full path once, so the symbols of
+/// one scope share its prefix and store only their leaf. The characters are
+/// packed into large chunks owned by the table. A symbol's name is a view
+/// onto its leaf when the leaf ends with it, so it usually costs no storage
+/// at all. Full paths are joined on demand by
+/// SymbolReference::getHierarchicalPath().
 class SymbolTable {
+public:
+  /// The identity of a symbol: the id of its scope and its leaf.
+  struct Key {
+    uint32_t scope;
+    std::string_view leaf;
+
+    auto operator==(Key const &) const -> bool = default;
+  };
+
+  struct KeyHash {
+    auto operator()(Key const &key) const -> size_t {
+      return std::hash<std::string_view>{}(key.leaf) ^
+             (static_cast<size_t>(key.scope) * 0x9e3779b97f4a7c15ULL);
+    }
+  };
+
+  /// Return the key of @p symbol.
+  static auto keyOf(SymbolReference const &symbol) -> Key {
+    return {symbol.scope->id, symbol.leaf};
+  }
+
+  /// Split @p path at its last `.` into a scope path and a leaf.
+  static auto splitPath(std::string_view path)
+      -> std::pair<std::string_view, std::string_view> {
+    auto dot = path.rfind('.');
+    if (dot == std::string_view::npos) {
+      return {{}, path};
+    }
+    return {path.substr(0, dot), path.substr(dot + 1)};
+  }
+
+private:
+  /// Size of a regular character chunk. Longer strings get a chunk of their
+  /// own.
+  static constexpr size_t chunkSize = size_t{1} << 16;
+
   // Stable storage: std::deque guarantees addresses survive insertion.
+  std::deque<SymbolScope> scopes;
   std::deque<SymbolReference> entries;
-  // Keys are string_views into entries[i].hierarchicalPath.
-  concurrent_map<std::string_view, SymbolReference const *> indexMap;
+  // Keys are views of scopes[i].path.
+  concurrent_map<std::string_view, SymbolScope const *> scopeMap;
+  // Keys are the scope ids and views of entries[i].leaf.
+  concurrent_map<Key, SymbolReference const *, KeyHash> indexMap;
   mutable std::mutex insertMutex;
+  // Character storage for the interned strings.
+  std::vector<std::unique_ptr<char[]>> chunks;
+  char *cursor = nullptr;
+  size_t remaining = 0;
+  size_t stringBytes = 0;
+
+  /// Copy @p str into the character storage. Caller must hold insertMutex.
+  auto store(std::string_view str) -> std::string_view {
+    if (str.empty()) {
+      return {};
+    }
+    stringBytes += str.size();
+    char *data = nullptr;
+    if (str.size() > chunkSize / 4) {
+      data = chunks.emplace_back(new char[str.size()]).get();
+    } else {
+      if (str.size() > remaining) {
+        cursor = chunks.emplace_back(new char[chunkSize]).get();
+        remaining = chunkSize;
+      }
+      data = cursor;
+      cursor += str.size();
+      remaining -= str.size();
+    }
+    std::memcpy(data, str.data(), str.size());
+    return {data, str.size()};
+  }
+
+  /// Return the scope with path @p path, interning it and its ancestors if
+  /// needed. Caller must hold insertMutex.
+  auto internScope(std::string_view path) -> SymbolScope const * {
+    if (auto const *scope = findScope(path)) {
+      return scope;
+    }
+    auto [parentPath, segment] = splitPath(path);
+    auto const *parent = internScope(parentPath);
+    auto stored = store(path);
+    auto &scope = scopes.emplace_back(SymbolScope{
+        parent, stored.substr(stored.size() - segment.size()), stored,
+        static_cast<uint32_t>(scopes.size()), parent->depth + 1});
+    scopeMap.emplace(scope.path, &scope);
+    return &scope;
+  }
+
+  /// Return the record for @p leaf in @p scope, or nullptr if there is
+  /// none.
+  auto findIn(SymbolScope const &scope, std::string_view leaf) const
+      -> SymbolReference const * {
+    SymbolReference const *result = nullptr;
+    indexMap.visit(Key{scope.id, leaf},
+                   [&](auto const &kv) { result = kv.second; });
+    return result;
+  }
 
 public:
+  SymbolTable() {
+    auto &root = scopes.emplace_back(SymbolScope{nullptr, {}, {}, 0, 0});
+    scopeMap.emplace(root.path, &root);
+  }
+
   /// Intern a SymbolReference. Returns a stable pointer to the canonical
   /// record. Thread safe.
   auto intern(std::string_view name, std::string_view hierarchicalPath,
               TextLocation location) -> SymbolReference const * {
-    SymbolReference const *result = nullptr;
-    if (indexMap.visit(hierarchicalPath,
-                       [&](auto const &kv) { result = kv.second; })) {
+    if (auto const *result = find(hierarchicalPath)) {
       return result;
     }
+    auto [scopePath, leaf] = splitPath(hierarchicalPath);
     std::lock_guard lock(insertMutex);
-    if (indexMap.visit(hierarchicalPath,
-                       [&](auto const &kv) { result = kv.second; })) {
+    auto const *scope = internScope(scopePath);
+    if (auto const *result = findIn(*scope, leaf)) {
       return result;
     }
+    auto storedLeaf = store(leaf);
+    auto storedName = storedLeaf.ends_with(name)
+                          ? storedLeaf.substr(storedLeaf.size() - name.size())
+                          : store(name);
     auto &stored = entries.emplace_back(
-        std::string(name), std::string(hierarchicalPath), location);
+        SymbolReference{storedName, scope, storedLeaf, location});
     auto *ptr = &stored;
-    indexMap.emplace(std::string_view(stored.hierarchicalPath), ptr);
+    indexMap.emplace(keyOf(stored), ptr);
     return ptr;
   }
 
+  /// Return the record interned for @p hierarchicalPath, or nullptr if
+  /// there is none. Thread safe.
+  auto find(std::string_view hierarchicalPath) const
+      -> SymbolReference const * {
+    auto [scopePath, leaf] = splitPath(hierarchicalPath);
+    auto const *scope = findScope(scopePath);
+    return scope != nullptr ? findIn(*scope, leaf) : nullptr;
+  }
+
+  /// Return the scope with path @p path, or nullptr if no symbol has been
+  /// interned in or below it. The root scope has the empty path. Thread
+  /// safe.
+  auto findScope(std::string_view path) const -> SymbolScope const * {
+    SymbolScope const *result = nullptr;
+    scopeMap.visit(path, [&](auto const &kv) { result = kv.second; });
+    return result;
+  }
+
   /// Convenience: intern by copying from an existing SymbolReference value.
   auto intern(SymbolReference const &ref) -> SymbolReference const * {
-    return intern(ref.name, ref.hierarchicalPath, ref.location);
+    return intern(ref.name, ref.getHierarchicalPath(), ref.location);
   }
 
   /// Number of unique symbol entries currently interned.
   auto size() const -> size_t { return entries.size(); }
+
+  /// Number of scopes currently interned, including the root.
+  auto numScopes() const -> size_t {
+    std::lock_guard lock(insertMutex);
+    return scopes.size();
+  }
+
+  /// Number of characters stored for the interned names, leaves and scope
+  /// paths.
+  auto getStringBytes() const -> size_t {
+    std::lock_guard lock(insertMutex);
+    return stringBytes;
+  }
 };
 
 } // namespace slang::netlist
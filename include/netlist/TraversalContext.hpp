@@ -0,0 +1,66 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace slang::netlist {
+
+/// Reusable scratch state for graph traversals.
+///
+/// The visited set is an array of epoch stamps indexed by node (the graph
+/// index of a NetlistNode, or the node index of a FrozenNetlist): a node is
+/// visited when its stamp equals the current epoch. Starting a new traversal
+/// bumps the epoch rather than clearing the array, so a context passed to a
+/// series of queries allocates once and then costs nothing per query beyond
+/// the nodes each query touches.
+///
+/// A context may be reused by any number of successive traversals, but must
+/// not be shared by traversals running concurrently.
+class TraversalContext {
+public:
+  TraversalContext() = default;
+
+  /// Begin a new traversal, forgetting every node marked by the previous
+  /// one. @p numNodes is a hint to size the array up front; it grows on
+  /// demand otherwise.
+  void reset(size_t numNodes = 0) {
+    if (stamps.size() < numNodes) {
+      stamps.resize(numNodes, 0);
+    }
+    if (++epoch == 0) {
+      // The epoch wrapped: stale stamps could now collide, so clear them.
+      std::ranges::fill(stamps, 0);
+      epoch = 1;
+    }
+  }
+
+  /// Mark node @p index as visited. Return false if it already was.
+  auto markVisited(size_t index) -> bool {
+    if (index >= stamps.size()) {
+      stamps.resize(std::max(index + 1, stamps.size() * 2), 0);
+    }
+    if (stamps[index] == epoch) {
+      return false;
+    }
+    stamps[index] = epoch;
+    return true;
+  }
+
+  /// Return true if node @p index has been visited by the current
+  /// traversal.
+  [[nodiscard]] auto isVisited(size_t index) const -> bool {
+    return index < stamps.size() && stamps[index] == epoch;
+  }
+
+  /// Return the number of nodes the visited array can hold without
+  /// growing.
+  [[nodiscard]] auto capacity() const -> size_t { return stamps.size(); }
+
+private:
+  std::vector<uint32_t> stamps;
+  uint32_t epoch{1};
+};
+
+} // namespace slang::netlist
@@ -34,7 +34,7 @@ class ReportVisitorBase
 protected:
   ast::Compilation &compilation;
   std::vector<Info> items;
-  std::vector<std::string> nameFilters;
+  netlist::WildcardSet nameFilters;
 
   /// Format a source location using the compilation's SourceManager.
   auto locationStr(SourceLocation loc) const -> std::string {
@@ -44,16 +44,7 @@ protected:
   /// Return true if no name filters are set, or if @p name matches at
   /// least one of them (glob syntax per netlist::wildcardMatch).
   auto nameMatches(std::string_view name) const -> bool {
-    if (nameFilters.empty()) {
-      return true;
-    }
-    auto subject = std::string(name);
-    for (auto const &pattern : nameFilters) {
-      if (netlist::wildcardMatch(subject.c_str(), pattern.c_str())) {
-        return true;
-      }
-    }
-    return false;
+    return nameFilters.empty() || nameFilters.matches(name);
   }
 
 public:
@@ -64,8 +55,8 @@ public:
   /// least one of @p filters (glob syntax per netlist::wildcardMatch:
   /// `*`/`?` stay within a single path segment, `**`/`...` cross
   /// boundaries). An empty list disables filtering.
-  void setNameFilters(std::vector<std::string> filters) {
-    nameFilters = std::move(filters);
+  void setNameFilters(std::vector<std::string> const &filters) {
+    nameFilters = netlist::WildcardSet(filters);
   }
 
   /// Render the collected information as a human-readable table.
@@ -0,0 +1,255 @@
+#pragma once
+
+#include "DepthFirstSearch.hpp"
+
+#include "netlist/NetlistGraph.hpp"
+#include "netlist/NetlistPath.hpp"
+
+#include "slang/util/FlatMap.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace slang::netlist {
+
+/// The bit numbering of a symbol over a range: that of a Port, Variable or
+/// State node, or of the symbol annotating an edge.
+struct BitSpace {
+  SymbolReference const *symbol;
+  DriverBitRange bounds;
+
+  /// Return the bit space of @p node, or nothing if it is an operation,
+  /// which has no bits.
+  static auto of(NetlistNode const &node) -> std::optional<BitSpace> {
+    switch (node.kind) {
+    case NodeKind::Port:
+      return BitSpace{node.as<Port>().symbol, node.as<Port>().bounds};
+    case NodeKind::Variable:
+      return BitSpace{node.as<Variable>().symbol, node.as<Variable>().bounds};
+    case NodeKind::State:
+      return BitSpace{node.as<State>().symbol, node.as<State>().bounds};
+    default:
+      return std::nullopt;
+    }
+  }
+
+  /// Return the bit space of the symbol annotating @p edge, if it has one.
+  static auto of(NetlistEdge const &edge) -> std::optional<BitSpace> {
+    if (!edge.hasSymbol()) {
+      return std::nullopt;
+    }
+    return BitSpace{edge.symbol, edge.bounds};
+  }
+
+  /// Return the bits of @p to corresponding to @p bits of this space, or
+  /// nothing if there are none. Bits of the same symbol correspond
+  /// directly. Otherwise, as at a port connection, the two ranges are
+  /// aligned if they have the same width, and if not, all of @p to is
+  /// taken to correspond to any bit.
+  [[nodiscard]] auto map(DriverBitRange bits, BitSpace const &to) const
+      -> std::optional<DriverBitRange> {
+    if (symbol == to.symbol) {
+      return bits.intersection(to.bounds);
+    }
+    auto clipped = bits.intersection(bounds);
+    if (!clipped) {
+      return std::nullopt;
+    }
+    if (bounds.width() != to.bounds.width()) {
+      return to.bounds;
+    }
+    auto const offset = to.bounds.lower() - bounds.lower();
+    return DriverBitRange{clipped->lower() + offset,
+                          clipped->upper() + offset};
+  }
+};
+
+/// A breadth-first traversal from a range of bits of a node that follows an
+/// edge only if it carries some of the bits reached at its near end, and
+/// records the bits it carries to the far end.
+///
+/// Bits are tracked at Port, Variable and State nodes. The bits reached at
+/// the far end of an edge are the bits reached at its near end mapped
+/// through the symbol and bounds annotating the edge, when it has one, into
+/// the bit space of the far node. An operation node only records that it
+/// is reached, and passes every bit annotating its edges on, since the
+/// graph does not say which of its input bits drive which output bits.
+///
+/// Each new range of bits reached at a node is expanded once, so the
+/// traversal ends even around loops, and records the range it was reached
+/// from, so a path can be traced back through ranges that carry each other.
+template <Direction Dir, typename EdgePredicate> class BitTraversal {
+public:
+  static constexpr auto none = std::numeric_limits<uint32_t>::max();
+
+  /// The nodes reached, in the order they were first reached, with the
+  /// disjoint ranges of their bits reached.
+  std::vector<NetlistGraph::BitNode> reached;
+
+  /// The step that reached the stop node, if it was reached.
+  uint32_t stopStep = none;
+
+  /// Traverse from @p bits of @p start, stopping as soon as @p stopAt is
+  /// reached if it is given.
+  BitTraversal(NetlistNode &start, DriverBitRange bits,
+               NetlistNode const *stopAt = nullptr) {
+    std::optional<DriverBitRange> startBits;
+    if (auto space = BitSpace::of(start)) {
+      startBits = bits.intersection(space->bounds);
+      if (!startBits) {
+        return;
+      }
+    }
+    reach(start, startBits, none);
+    for (uint32_t s = 0; s < steps.size(); s++) {
+      auto const step = steps[s];
+      auto &node = *reached[step.node].node;
+      if (&node == stopAt) {
+        stopStep = s;
+        return;
+      }
+      if constexpr (Dir == Direction::Forward) {
+        for (auto const &edge : node.getOutEdges()) {
+          if (EdgePredicate{}(*edge)) {
+            follow(node, step.bits, *edge, edge->getTargetNode(), s);
+          }
+        }
+      } else {
+        for (auto *edge : node.getInEdges()) {
+          if (EdgePredicate{}(*edge)) {
+            follow(node, step.bits, *edge, edge->getSourceNode(), s);
+          }
+        }
+      }
+    }
+  }
+
+  /// Return the path from the start to the node of step @p s, through the
+  /// steps that reached each other.
+  [[nodiscard]] auto pathTo(uint32_t s) const -> NetlistPath {
+    NetlistPath path;
+    for (; s != none; s = steps[s].parent) {
+      path.add(reached[steps[s].node].node);
+    }
+    if constexpr (Dir == Direction::Forward) {
+      path.reverse();
+    }
+    return path;
+  }
+
+  /// Return the nodes reached with each one's bits merged into ascending,
+  /// non-abutting ranges.
+  [[nodiscard]] auto takeReached() -> std::vector<NetlistGraph::BitNode> {
+    for (auto &entry : reached) {
+      auto &bits = entry.bits;
+      size_t merged = 0;
+      for (size_t i = 0; i < bits.size(); i++) {
+        if (merged != 0 && bits[merged - 1].isContiguousWith(bits[i])) {
+          bits[merged - 1] = bits[merged - 1].unionWith(bits[i]);
+        } else {
+          bits[merged++] = bits[i];
+        }
+      }
+      bits.resize(merged);
+    }
+    return std::move(reached);
+  }
+
+private:
+  /// A range of bits reached at a node, or the node itself if it is an
+  /// operation, and the step it was reached from.
+  struct Step {
+    uint32_t node;
+    std::optional<DriverBitRange> bits;
+    uint32_t parent;
+  };
+
+  std::vector<Step> steps;
+  flat_hash_map<NetlistNode const *, uint32_t> reachedIndex;
+
+  /// Follow @p edge from @p bits of @p from, reached by step @p parent, to
+  /// @p to.
+  void follow(NetlistNode const &from, std::optional<DriverBitRange> bits,
+              NetlistEdge const &edge, NetlistNode &to, uint32_t parent) {
+    auto const fromSpace = BitSpace::of(from);
+    auto const toSpace = BitSpace::of(to);
+
+    // An operation passes on every bit of the edge, and an edge without
+    // an annotation passes on the bits of its near end as they are.
+    if (auto edgeSpace = BitSpace::of(edge)) {
+      auto edgeBits = edgeSpace->bounds;
+      if (fromSpace) {
+        auto mapped = fromSpace->map(*bits, *edgeSpace);
+        if (!mapped) {
+          return;
+        }
+        edgeBits = *mapped;
+      }
+      if (!toSpace) {
+        reach(to, std::nullopt, parent);
+      } else if (auto toBits = edgeSpace->map(edgeBits, *toSpace)) {
+        reach(to, toBits, parent);
+      }
+    } else if (!toSpace) {
+      reach(to, std::nullopt, parent);
+    } else if (!fromSpace) {
+      reach(to, toSpace->bounds, parent);
+    } else if (auto toBits = fromSpace->map(*bits, *toSpace)) {
+      reach(to, toBits, parent);
+    }
+  }
+
+  /// Record that @p bits of @p node, or the node itself if it is an
+  /// operation, are reached from step @p parent, adding a step for each
+  /// range of them not reached before.
+  void reach(NetlistNode &node, std::optional<DriverBitRange> bits,
+             uint32_t parent) {
+    auto [it, inserted] =
+        reachedIndex.try_emplace(&node, static_cast<uint32_t>(reached.size()));
+    if (inserted) {
+      reached.push_back({&node, {}});
+    }
+    auto const index = it->second;
+    if (!bits) {
+      if (inserted) {
+        steps.push_back({index, std::nullopt, parent});
+      }
+      return;
+    }
+
+    // Split off the parts of the range not yet reached, keeping the
+    // node's ranges sorted.
+    auto &known = reached[index].bits;
+    auto const numKnown = known.size();
+    auto lower = bits->lower();
+    auto addRange = [&](int32_t first, int32_t last) {
+      known.push_back({first, last});
+      steps.push_back({index, DriverBitRange{first, last}, parent});
+    };
+    for (size_t i = 0; i < numKnown && lower <= bits->upper(); i++) {
+      auto const range = known[i];
+      if (range.upper() < lower) {
+        continue;
+      }
+      if (range.lower() > bits->upper()) {
+        break;
+      }
+      if (range.lower() > lower) {
+        addRange(lower, range.lower() - 1);
+      }
+      lower = range.upper() + 1;
+    }
+    if (lower <= bits->upper()) {
+      addRange(lower, bits->upper());
+    }
+    if (known.size() != numKnown) {
+      std::ranges::sort(known, {}, &DriverBitRange::lower);
+    }
+  }
+};
+
+} // namespace slang::netlist
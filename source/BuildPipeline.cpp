@@ -103,6 +103,7 @@ void BuildPipeline::runPhase2Parallel() {
   recordTaskStats(allWork);
 
   auto t4 = Clock::now();
+  PendingRvalueQueue::linkStagedEdges(allWork, *threadPool, profile);
   builder.pendingQueue.drain(allWork, profile);
   profile.phase3_drainSeconds =
       std::chrono::duration<double>(Clock::now() - t4).count();
@@ -148,7 +149,7 @@ void BuildPipeline::run(ast::Symbol const &root) {
 void BuildPipeline::finalize() {
   using Clock = std::chrono::steady_clock;
   auto t0 = Clock::now();
-  builder.pendingQueue.resolve(threadPool.get());
+  builder.pendingQueue.resolve(threadPool.get(), profile);
   threadPool.reset();
   profile.phase4_rvalueSeconds =
       std::chrono::duration<double>(Clock::now() - t0).count();
@@ -19,7 +19,8 @@ class NetlistBuilder;
 ///   1. Sequential AST traversal: ports, variables, instance structure;
 ///      procedural and continuous-assign blocks are collected for later.
 ///   2. Parallel (or sequential) dispatch of the deferred DFA blocks.
-///   3. Drain per-task pending-rvalue buffers into the shared queue.
+///   3. Link the edges staged by each task and drain per-task
+///      pending-rvalue buffers into the shared queue.
 ///   4. Resolve pending rvalues into edges, then tear down the pool.
 ///
 /// Owns phase-scoped state — the thread pool, the deferred-block list,
@@ -0,0 +1,107 @@
+#include "netlist/ClockDomainMap.hpp"
+
+#include "SetInterner.hpp"
+#include "StronglyConnectedComponents.hpp"
+
+#include <algorithm>
+#include <utility>
+
+using namespace slang::netlist;
+
+namespace {
+
+/// Each key of a domain combines the graph index of a source node with an
+/// edge kind.
+constexpr unsigned edgeKindBits = 8;
+
+auto makeKey(size_t source, slang::ast::EdgeKind edgeKind) -> uint64_t {
+  return (static_cast<uint64_t>(source) << edgeKindBits) |
+         static_cast<uint8_t>(edgeKind);
+}
+
+} // namespace
+
+ClockDomainMap::ClockDomainMap(NetlistGraph const &graph)
+    : graph(graph), version(graph.getNodeListVersion()) {
+  SLANG_ASSERT(!graph.hasReleasedEdges());
+  auto const numNodes = graph.numNodes();
+
+  // The enabled edges out of non-State nodes, including those into State
+  // nodes. State nodes have no successors, so each is a component of its
+  // own and the walk ends there, as in getSensitivity.
+  std::vector<uint32_t> firstEdge;
+  std::vector<uint32_t> targets;
+  firstEdge.reserve(numNodes + 1);
+  firstEdge.push_back(0);
+  for (auto const &node : graph) {
+    if (node->kind != NodeKind::State) {
+      for (auto const &edge : node->getOutEdges()) {
+        if (!edge->disabled) {
+          targets.push_back(
+              static_cast<uint32_t>(edge->getTargetNode().getGraphIndex()));
+        }
+      }
+    }
+    firstEdge.push_back(static_cast<uint32_t>(targets.size()));
+  }
+  StronglyConnectedComponents scc(firstEdge, targets);
+  std::vector<uint32_t> firstMember;
+  std::vector<uint32_t> members;
+  scc.groupMembers(firstMember, members);
+
+  // Each distinct set is numbered in the order it is first seen, with the
+  // empty set first.
+  SetInterner sets;
+  static_assert(SetInterner::empty_set == empty_domain);
+
+  // Components are numbered after every component they reach, so visiting
+  // them in ascending order finds the domains of a component's successors
+  // before its own.
+  std::vector<DomainIndex> componentDomains(scc.numComponents, empty_domain);
+  std::vector<uint32_t> lastSource(scc.numComponents,
+                                   StronglyConnectedComponents::unvisited);
+  for (uint32_t c = 0; c < scc.numComponents; c++) {
+    auto domain = empty_domain;
+    for (auto m = firstMember[c]; m < firstMember[c + 1]; m++) {
+      auto const node = members[m];
+      auto const &netlistNode = graph.getNode(node);
+      if (netlistNode.kind == NodeKind::State) {
+        SetInterner::KeySet set;
+        for (auto const *edge : netlistNode.getInEdges()) {
+          if (!edge->disabled && edge->edgeKind != ast::EdgeKind::None) {
+            set.push_back(makeKey(edge->getSourceNode().getGraphIndex(),
+                                  edge->edgeKind));
+          }
+        }
+        std::ranges::sort(set);
+        auto [first, last] = std::ranges::unique(set);
+        set.erase(first, last);
+        domain = sets.intern(std::move(set));
+        continue;
+      }
+      for (auto e = firstEdge[node]; e < firstEdge[node + 1]; e++) {
+        auto target = scc.components[targets[e]];
+        if (target != c && lastSource[target] != c) {
+          lastSource[target] = c;
+          domain = sets.unite(domain, componentDomains[target]);
+        }
+      }
+    }
+    componentDomains[c] = domain;
+  }
+
+  domains.resize(numNodes);
+  for (size_t node = 0; node < numNodes; node++) {
+    domains[node] = componentDomains[scc.components[node]];
+  }
+  firstSource.reserve(sets.size() + 1);
+  firstSource.push_back(0);
+  for (SetInterner::SetIndex d = 0; d < sets.size(); d++) {
+    for (auto key : sets[d]) {
+      sources.push_back(
+          {&graph.getNode(key >> edgeKindBits),
+           static_cast<ast::EdgeKind>(key & ((1U << edgeKindBits) - 1))});
+    }
+    firstSource.push_back(static_cast<uint32_t>(sources.size()));
+  }
+}
@@ -1,13 +1,23 @@
 #include "netlist/CombLoops.hpp"
 
-#include "CycleDetector.hpp"
+#include "QueryPool.hpp"
+#include "StronglyConnectedComponents.hpp"
 
 #include "netlist/NetlistEdge.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
 namespace slang::netlist {
 
 namespace {
 
+/// Sets of components with fewer nodes than this in total are searched on
+/// the calling thread.
+constexpr size_t parallelThreshold = 256;
+
 struct CombEdgePredicate {
   CombEdgePredicate() = default;
   bool operator()(const NetlistEdge &edge) {
@@ -16,13 +26,250 @@ struct CombEdgePredicate {
   }
 };
 
+using Loop = std::vector<const NetlistNode *>;
+
+/// The strongly connected components of the combinational graph that
+/// contain a loop, each with its nodes in ascending ID order.
+struct LoopComponents {
+  std::vector<std::vector<const NetlistNode *>> components;
+
+  /// The combinational successors of each node, by graph index.
+  std::vector<uint32_t> firstEdge;
+  std::vector<uint32_t> targets;
+
+  /// The component of each node, by graph index.
+  std::vector<uint32_t> componentOf;
+
+  explicit LoopComponents(NetlistGraph const &netlist) {
+    SLANG_ASSERT(!netlist.hasReleasedEdges());
+    firstEdge.reserve(netlist.numNodes() + 1);
+    firstEdge.push_back(0);
+    for (auto const &node : netlist) {
+      for (auto const &edge : node->getOutEdges()) {
+        if (CombEdgePredicate{}(*edge)) {
+          targets.push_back(
+              static_cast<uint32_t>(edge->getTargetNode().getGraphIndex()));
+        }
+      }
+      firstEdge.push_back(static_cast<uint32_t>(targets.size()));
+    }
+    StronglyConnectedComponents scc(firstEdge, targets);
+    std::vector<uint32_t> firstMember;
+    std::vector<uint32_t> members;
+    scc.groupMembers(firstMember, members);
+    for (uint32_t c = 0; c < scc.numComponents; c++) {
+      auto const first = members[firstMember[c]];
+      bool hasLoop = firstMember[c + 1] - firstMember[c] > 1 ||
+                     std::ranges::find(targets.begin() + firstEdge[first],
+                                       targets.begin() + firstEdge[first + 1],
+                                       first) !=
+                         targets.begin() + firstEdge[first + 1];
+      if (!hasLoop) {
+        continue;
+      }
+      auto &component = components.emplace_back();
+      for (auto m = firstMember[c]; m < firstMember[c + 1]; m++) {
+        component.push_back(&netlist.getNode(members[m]));
+      }
+      std::ranges::sort(component, {}, &NetlistNode::ID);
+    }
+    std::ranges::sort(components, {}, [](auto const &component) {
+      return component.front()->ID;
+    });
+    componentOf = std::move(scc.components);
+  }
+};
+
+/// Return the elementary loops of @p component, at most @p maxLoops of them
+/// if it is non-zero, using Johnson's algorithm. @p truncated is set if the
+/// component has more loops than that.
+auto findLoops(LoopComponents const &graph,
+               std::vector<const NetlistNode *> const &component,
+               size_t maxLoops, bool &truncated) -> std::vector<Loop> {
+  // Number the nodes by their position in the component, which is in ID
+  // order, and keep the edges between them without duplicates.
+  auto const numMembers = static_cast<uint32_t>(component.size());
+  auto const self = graph.componentOf[component.front()->getGraphIndex()];
+  std::vector<std::vector<uint32_t>> successors(numMembers);
+  {
+    std::vector<std::pair<uint32_t, uint32_t>> local;
+    local.reserve(numMembers);
+    for (uint32_t i = 0; i < numMembers; i++) {
+      local.emplace_back(component[i]->getGraphIndex(), i);
+    }
+    std::ranges::sort(local);
+    auto toLocal = [&](uint32_t node) {
+      return std::ranges::lower_bound(local, std::pair(node, 0U))->second;
+    };
+    for (uint32_t i = 0; i < numMembers; i++) {
+      auto node = static_cast<uint32_t>(component[i]->getGraphIndex());
+      for (auto e = graph.firstEdge[node]; e < graph.firstEdge[node + 1];
+           e++) {
+        auto target = graph.targets[e];
+        if (graph.componentOf[target] == self) {
+          successors[i].push_back(toLocal(target));
+        }
+      }
+      std::ranges::sort(successors[i]);
+      auto [first, last] = std::ranges::unique(successors[i]);
+      successors[i].erase(first, last);
+    }
+  }
+
+  // Johnson's algorithm: find the loops whose lowest node is each node s in
+  // turn, searching only the strongly connected component of s in the
+  // subgraph of the nodes from s up, which holds every such loop. A node
+  // stays blocked until a loop is found through it, and blockedBy[w] lists
+  // the nodes to unblock when w is unblocked. One loop beyond the limit is
+  // looked for, to tell whether the limit cut the search short.
+  std::vector<Loop> loops;
+  auto const searchLimit = maxLoops == 0 ? 0 : maxLoops + 1;
+  std::vector<uint8_t> inComponent(numMembers);
+  std::vector<uint32_t> subFirstEdge;
+  std::vector<uint32_t> subTargets;
+  std::vector<uint8_t> blocked(numMembers);
+  std::vector<std::vector<uint32_t>> blockedBy(numMembers);
+  std::vector<uint32_t> unblockStack;
+  auto unblock = [&](uint32_t node) {
+    unblockStack.push_back(node);
+    while (!unblockStack.empty()) {
+      auto next = unblockStack.back();
+      unblockStack.pop_back();
+      if (blocked[next] == 0) {
+        continue;
+      }
+      blocked[next] = 0;
+      unblockStack.insert(unblockStack.end(), blockedBy[next].begin(),
+                          blockedBy[next].end());
+      blockedBy[next].clear();
+    }
+  };
+  struct Frame {
+    uint32_t node;
+    uint32_t edge;
+    bool foundLoop;
+  };
+  std::vector<Frame> stack;
+  for (uint32_t s = 0; s < numMembers; s++) {
+    subFirstEdge.assign(1, 0);
+    subTargets.clear();
+    for (auto i = s; i < numMembers; i++) {
+      for (auto w : successors[i]) {
+        if (w >= s) {
+          subTargets.push_back(w - s);
+        }
+      }
+      subFirstEdge.push_back(static_cast<uint32_t>(subTargets.size()));
+    }
+    StronglyConnectedComponents const scc(subFirstEdge, subTargets);
+    for (auto i = s; i < numMembers; i++) {
+      inComponent[i] = scc.components[i - s] == scc.components[0];
+    }
+
+    std::fill(blocked.begin() + s, blocked.end(), 0);
+    for (auto i = s; i < numMembers; i++) {
+      blockedBy[i].clear();
+    }
+    blocked[s] = 1;
+    stack.push_back({s, 0, false});
+    while (!stack.empty()) {
+      auto &frame = stack.back();
+      auto const &next = successors[frame.node];
+      if (frame.edge < next.size()) {
+        auto w = next[frame.edge++];
+        if (w == s) {
+          auto &loop = loops.emplace_back();
+          for (auto const &entry : stack) {
+            loop.push_back(component[entry.node]);
+          }
+          frame.foundLoop = true;
+          if (loops.size() == searchLimit) {
+            loops.pop_back();
+            truncated = true;
+            return loops;
+          }
+        } else if (w > s && inComponent[w] != 0 && blocked[w] == 0) {
+          blocked[w] = 1;
+          stack.push_back({w, 0, false});
+        }
+        continue;
+      }
+      auto const done = frame;
+      stack.pop_back();
+      if (done.foundLoop) {
+        unblock(done.node);
+        if (!stack.empty()) {
+          stack.back().foundLoop = true;
+        }
+      } else {
+        for (auto w : next) {
+          if (w > s && inComponent[w] != 0 &&
+              std::ranges::find(blockedBy[w], done.node) ==
+                  blockedBy[w].end()) {
+            blockedBy[w].push_back(done.node);
+          }
+        }
+      }
+    }
+  }
+  return loops;
+}
+
 } // namespace
 
-auto CombLoops::getAllLoops() -> std::vector<std::vector<const NetlistNode *>> {
-  using CycleDetectorType =
-      CycleDetector<NetlistNode, NetlistEdge, CombEdgePredicate>;
-  CycleDetectorType detector(netlist);
-  return detector.detectCycles();
+auto CombLoops::getLoopComponents() const
+    -> std::vector<std::vector<const NetlistNode *>> {
+  return LoopComponents(netlist).components;
+}
+
+auto CombLoops::getAllLoops(
+    size_t maxLoopsPerComponent,
+    std::vector<std::vector<const NetlistNode *>> *truncated) const
+    -> std::vector<std::vector<const NetlistNode *>> {
+  LoopComponents const graph(netlist);
+  auto const &components = graph.components;
+
+  // Each task writes only the loops and flag of its own component.
+  std::vector<std::vector<Loop>> found(components.size());
+  std::vector<uint8_t> cutShort(components.size(), 0);
+  auto search = [&](size_t c) {
+    bool limited = false;
+    found[c] = findLoops(graph, components[c], maxLoopsPerComponent, limited);
+    cutShort[c] = limited;
+  };
+  size_t numMembers = 0;
+  for (auto const &component : components) {
+    numMembers += component.size();
+  }
+  auto &pool = netlist.getQueryPool();
+  if (components.size() > 1 && numMembers >= parallelThreshold &&
+      !pool.isSerial()) {
+    pool.forEach(components.size(), search);
+  } else {
+    for (size_t c = 0; c < components.size(); c++) {
+      search(c);
+    }
+  }
+
+  std::vector<Loop> result;
+  for (auto &loops : found) {
+    std::ranges::move(loops, std::back_inserter(result));
+  }
+  if (truncated != nullptr) {
+    truncated->clear();
+    for (size_t c = 0; c < components.size(); c++) {
+      if (cutShort[c] != 0) {
+        truncated->push_back(components[c]);
+      }
+    }
+  }
+
+  // Canonicalise the result by sorting by node ID.
+  std::ranges::sort(result, [](Loop const &a, Loop const &b) {
+    return std::ranges::lexicographical_compare(a, b, {}, &NetlistNode::ID,
+                                                &NetlistNode::ID);
+  });
+  return result;
 }
 
 } // namespace slang::netlist
@@ -0,0 +1,139 @@
+#include "netlist/ConstantDriverMap.hpp"
+
+#include "SetInterner.hpp"
+#include "StronglyConnectedComponents.hpp"
+
+#include <utility>
+
+using namespace slang::netlist;
+
+namespace {
+
+/// The sources other than Constants found in a fan-in.
+enum SourceFlags : uint8_t {
+  NoSources = 0,
+  StateSource = 1,
+  ExternalSource = 2,
+};
+
+/// Return true if @p node is an external source: an undriven Port, which
+/// is a top-level input.
+auto isExternal(NetlistNode const &node) -> bool {
+  return node.kind == NodeKind::Port && !node.as<Port>().isDriven();
+}
+
+} // namespace
+
+ConstantDriverMap::ConstantDriverMap(NetlistGraph const &graph)
+    : graph(graph), version(graph.getNodeListVersion()) {
+  SLANG_ASSERT(!graph.hasReleasedEdges());
+  auto const numNodes = graph.numNodes();
+
+  // The enabled edges out of non-State nodes, which are the edges a fan-in
+  // search follows backwards. An edge from a State node marks the fan-in
+  // as state-dependent instead.
+  std::vector<uint32_t> firstEdge;
+  std::vector<uint32_t> targets;
+  firstEdge.reserve(numNodes + 1);
+  firstEdge.push_back(0);
+  for (auto const &node : graph) {
+    if (node->kind != NodeKind::State) {
+      for (auto const &edge : node->getOutEdges()) {
+        if (!edge->disabled) {
+          targets.push_back(
+              static_cast<uint32_t>(edge->getTargetNode().getGraphIndex()));
+        }
+      }
+    }
+    firstEdge.push_back(static_cast<uint32_t>(targets.size()));
+  }
+  StronglyConnectedComponents scc(firstEdge, targets);
+  std::vector<uint32_t> firstMember;
+  std::vector<uint32_t> members;
+  scc.groupMembers(firstMember, members);
+
+  SetInterner sets;
+  driveKinds.resize(numNodes);
+  constantSets.resize(numNodes);
+  auto classify = [&](uint32_t node, uint8_t flags,
+                      SetInterner::SetIndex set) {
+    constantSets[node] = set;
+    if ((flags & StateSource) != 0) {
+      driveKinds[node] = DriveKind::State;
+    } else if ((flags & ExternalSource) != 0) {
+      driveKinds[node] = DriveKind::External;
+    } else if (set != SetInterner::empty_set) {
+      driveKinds[node] = DriveKind::Constant;
+    } else {
+      driveKinds[node] = DriveKind::None;
+    }
+  };
+
+  // The fan-in of each component including its own members, which is what
+  // it contributes to the fan-in of its successors. Components are
+  // numbered after every component they reach, so visiting them in
+  // descending order finds the fan-ins of a component's predecessors
+  // before its own.
+  std::vector<uint8_t> componentFlags(scc.numComponents, NoSources);
+  std::vector<SetInterner::SetIndex> componentSets(scc.numComponents,
+                                                   SetInterner::empty_set);
+  std::vector<uint32_t> lastTarget(scc.numComponents,
+                                   StronglyConnectedComponents::unvisited);
+  for (auto c = scc.numComponents; c-- > 0;) {
+    uint8_t flags = NoSources;
+    auto set = SetInterner::empty_set;
+    for (auto m = firstMember[c]; m < firstMember[c + 1]; m++) {
+      for (auto const *edge : graph.getNode(members[m]).getInEdges()) {
+        if (edge->disabled) {
+          continue;
+        }
+        auto const &source = edge->getSourceNode();
+        if (source.kind == NodeKind::State) {
+          flags |= StateSource;
+          continue;
+        }
+        auto from = scc.components[source.getGraphIndex()];
+        if (from != c && lastTarget[from] != c) {
+          lastTarget[from] = c;
+          flags |= componentFlags[from];
+          set = sets.unite(set, componentSets[from]);
+        }
+      }
+    }
+
+    // A node is not in its own fan-in, but the other members of a loop
+    // are.
+    uint32_t numExternal = 0;
+    SetInterner::KeySet memberConstants;
+    for (auto m = firstMember[c]; m < firstMember[c + 1]; m++) {
+      auto const &node = graph.getNode(members[m]);
+      numExternal += isExternal(node) ? 1 : 0;
+      if (node.kind == NodeKind::Constant) {
+        memberConstants.push_back(members[m]);
+      }
+    }
+    if (firstMember[c + 1] - firstMember[c] == 1) {
+      classify(members[firstMember[c]], flags, set);
+    } else {
+      for (auto m = firstMember[c]; m < firstMember[c + 1]; m++) {
+        auto const node = members[m];
+        auto others = memberConstants;
+        std::erase(others, node);
+        auto external = numExternal > (isExternal(graph.getNode(node)) ? 1 : 0);
+        classify(node, flags | (external ? ExternalSource : NoSources),
+                 sets.unite(set, sets.intern(std::move(others))));
+      }
+    }
+    componentFlags[c] = flags | (numExternal > 0 ? ExternalSource : NoSources);
+    componentSets[c] = sets.unite(set, sets.intern(std::move(memberConstants)));
+  }
+
+  firstConstant.reserve(sets.size() + 1);
+  firstConstant.push_back(0);
+  for (SetInterner::SetIndex s = 0; s < sets.size(); s++) {
+    for (auto key : sets[s]) {
+      constants.push_back(&graph.getNode(key));
+    }
+    firstConstant.push_back(static_cast<uint32_t>(constants.size()));
+  }
+}
@@ -7,7 +7,6 @@
 
 #include <algorithm>
 #include <set>
-#include <unordered_set>
 #include <vector>
 
 namespace slang::netlist {
@@ -69,21 +68,23 @@ public:
   /// vector of nodes.
   auto detectCycles() {
     std::set<CycleType> cycles;
+    visitedNodes.assign(graph.numNodes(), false);
 
     // Start a DFS traversal from each node
     for (const auto &nodePtr : graph) {
       CycleDetectionVisitor<NodeType, EdgeType> visitor;
       const auto *startNode = nodePtr.get();
-      if (visitedNodes.count(startNode) == 0) {
+      if (!visitedNodes[startNode->getGraphIndex()]) {
 
         // Mark the starting node as visited.
-        visitedNodes.insert(startNode);
+        visitedNodes[startNode->getGraphIndex()] = true;
 
-        // Perform DFS traversal.
+        // Perform DFS traversal, reusing the scratch storage of the previous
+        // one.
         DepthFirstSearch<NodeType, EdgeType,
                          CycleDetectionVisitor<NodeType, EdgeType>,
                          EdgePredicate>
-            dfs(visitor, *nodePtr);
+            dfs(context, visitor, *nodePtr);
 
         // Additionally, mark all nodes in cycles as visited to avoid
         // redundant DFS calls.
@@ -111,12 +112,14 @@ public:
 
 private:
   const DirectedGraph<NodeType, EdgeType> &graph;
-  std::unordered_set<const NodeType *> visitedNodes;
+  /// Start nodes already covered, indexed by graph index.
+  std::vector<bool> visitedNodes;
+  TraversalContext context;
 
   void markAllVisitedNodes(CycleDetectionVisitor<NodeType, EdgeType> &visitor) {
     for (const auto &cycle : visitor.getCycles()) {
       for (const auto node : cycle) {
-        visitedNodes.insert(node);
+        visitedNodes[node->getGraphIndex()] = true;
       }
     }
   }
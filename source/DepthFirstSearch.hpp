@@ -1,6 +1,12 @@
 #pragma once
 
-#include <set>
+#include "netlist/TraversalContext.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace slang::netlist {
@@ -13,6 +19,10 @@ struct select_all {
   template <typename T> auto operator()(const T &) const -> bool {
     return true;
   }
+  template <typename G, typename T>
+  auto operator()(const G &, const T &) const -> bool {
+    return true;
+  }
 };
 
 /// Depth-first search on a directed graph. A visitor class provides visibility
@@ -20,18 +30,37 @@ struct select_all {
 /// selects which edges can be included in the traversal. The Direction
 /// parameter controls whether the search follows outgoing (Forward) or
 /// incoming (Backward) edges.
+///
+/// Visited nodes are tracked by graph index in a TraversalContext, so every
+/// node reached must belong to a DirectedGraph. Callers running many
+/// searches can pass in the same context to each to reuse its storage.
 template <class NodeType, class EdgeType, class Visitor,
           class EdgePredicate = select_all, Direction Dir = Direction::Forward>
 class DepthFirstSearch {
 public:
-  DepthFirstSearch(Visitor &visitor, NodeType &startNode) : visitor(visitor) {
+  DepthFirstSearch(Visitor &visitor, NodeType &startNode)
+      : context(ownContext), visitor(visitor) {
     setup(startNode);
     run();
   }
 
   DepthFirstSearch(Visitor &visitor, EdgePredicate edgePredicate,
                    NodeType &startNode)
-      : visitor(visitor), edgePredicate(edgePredicate) {
+      : context(ownContext), visitor(visitor), edgePredicate(edgePredicate) {
+    setup(startNode);
+    run();
+  }
+
+  DepthFirstSearch(TraversalContext &context, Visitor &visitor,
+                   NodeType &startNode)
+      : context(context), visitor(visitor) {
+    setup(startNode);
+    run();
+  }
+
+  DepthFirstSearch(TraversalContext &context, Visitor &visitor,
+                   EdgePredicate edgePredicate, NodeType &startNode)
+      : context(context), visitor(visitor), edgePredicate(edgePredicate) {
     setup(startNode);
     run();
   }
@@ -70,9 +99,20 @@ private:
       return edge.getSourceNode();
   }
 
+  /// Return the key of @p node in the visited set. Throws if the node is
+  /// not in a graph, since its index would be out of range of any set.
+  static auto indexOf(NodeType const &node) -> size_t {
+    auto index = node.getGraphIndex();
+    if (index == std::numeric_limits<size_t>::max()) {
+      throw std::invalid_argument("node is not in a graph");
+    }
+    return index;
+  }
+
   /// Setup the traversal.
   void setup(NodeType &startNode) {
-    visitedNodes.insert(&startNode);
+    context.reset();
+    context.markVisited(indexOf(startNode));
     visitStack.push_back(VisitStackElement(startNode, edgeBegin(startNode)));
     visitor.visitNode(startNode);
   }
@@ -82,6 +122,7 @@ private:
     while (!visitStack.empty()) {
       auto &node = visitStack.back().first;
       auto &nodeIt = visitStack.back().second;
+      bool descended = false;
       // Visit each child node that hasn't already been visited.
       while (nodeIt != edgeEnd(node)) {
         auto *edge = edgePtr(nodeIt);
@@ -92,29 +133,150 @@ private:
           continue;
         }
 
-        if (visitedNodes.count(&target) != 0) {
+        if (!context.markVisited(indexOf(target))) {
           // This node has already been visited.
           visitor.visitedNode(target);
         } else {
-          // Push a new 'current' node onto the stack and mark it as
-          // visited.
+          // Push a new 'current' node onto the stack and descend into it.
+          // Note that the push may invalidate 'node' and 'nodeIt'.
           visitStack.push_back(VisitStackElement(target, edgeBegin(target)));
-          visitedNodes.insert(&target);
           visitor.visitEdge(*edge);
           visitor.visitNode(target);
-          return run();
+          descended = true;
+          break;
+        }
+      }
+      if (!descended) {
+        // All children of this node have been visited or skipped, so remove
+        // from the stack.
+        visitStack.pop_back();
+        visitor.popNode();
+      }
+    }
+  }
+
+  TraversalContext ownContext;
+  TraversalContext &context;
+  Visitor &visitor;
+  EdgePredicate edgePredicate;
+  std::vector<VisitStackElement> visitStack;
+};
+
+/// Depth-first search over an index-based graph snapshot, such as
+/// FrozenNetlist. Nodes and edges are identified by dense indices: the
+/// visitor receives indices, and the edge predicate is called with the graph
+/// and an edge index. Edges are explored in the same order as the snapshot's
+/// source graph, so the visit order matches DepthFirstSearch over that graph.
+/// As with DepthFirstSearch, a TraversalContext can be passed in to reuse
+/// the visited set across searches.
+template <class GraphType, class Visitor, class EdgePredicate = select_all,
+          Direction Dir = Direction::Forward>
+class IndexedDepthFirstSearch {
+public:
+  using NodeIndex = typename GraphType::NodeIndex;
+  using EdgeIndex = typename GraphType::EdgeIndex;
+
+  IndexedDepthFirstSearch(GraphType const &graph, Visitor &visitor,
+                          NodeIndex startNode)
+      : context(ownContext), graph(graph), visitor(visitor) {
+    setup(startNode);
+    run();
+  }
+
+  IndexedDepthFirstSearch(GraphType const &graph, Visitor &visitor,
+                          EdgePredicate edgePredicate, NodeIndex startNode)
+      : context(ownContext), graph(graph), visitor(visitor),
+        edgePredicate(edgePredicate) {
+    setup(startNode);
+    run();
+  }
+
+  IndexedDepthFirstSearch(TraversalContext &context, GraphType const &graph,
+                          Visitor &visitor, NodeIndex startNode)
+      : context(context), graph(graph), visitor(visitor) {
+    setup(startNode);
+    run();
+  }
+
+  IndexedDepthFirstSearch(TraversalContext &context, GraphType const &graph,
+                          Visitor &visitor, EdgePredicate edgePredicate,
+                          NodeIndex startNode)
+      : context(context), graph(graph), visitor(visitor),
+        edgePredicate(edgePredicate) {
+    setup(startNode);
+    run();
+  }
+
+private:
+  static auto edges(GraphType const &graph, NodeIndex node) {
+    if constexpr (Dir == Direction::Forward)
+      return graph.outEdges(node);
+    else
+      return graph.inEdges(node);
+  }
+
+  static auto nextNode(GraphType const &graph, EdgeIndex edge) -> NodeIndex {
+    if constexpr (Dir == Direction::Forward)
+      return graph.getTarget(edge);
+    else
+      return graph.getSource(edge);
+  }
+
+  using EdgeRangeType =
+      decltype(edges(std::declval<GraphType const &>(), NodeIndex{}));
+  using EdgeIteratorType = decltype(std::declval<EdgeRangeType &>().begin());
+
+  struct VisitStackElement {
+    EdgeIteratorType it;
+    EdgeIteratorType end;
+  };
+
+  void push(NodeIndex node) {
+    auto range = edges(graph, node);
+    context.markVisited(node);
+    visitStack.push_back({range.begin(), range.end()});
+  }
+
+  void setup(NodeIndex startNode) {
+    context.reset(graph.numNodes());
+    push(startNode);
+    visitor.visitNode(startNode);
+  }
+
+  void run() {
+    while (!visitStack.empty()) {
+      auto &top = visitStack.back();
+      bool descended = false;
+      while (top.it != top.end) {
+        EdgeIndex edge = *top.it;
+        ++top.it;
+        if (!edgePredicate(graph, edge)) {
+          continue;
+        }
+        auto target = nextNode(graph, edge);
+        if (context.isVisited(target)) {
+          visitor.visitedNode(target);
+        } else {
+          // Note that push() may invalidate 'top'.
+          push(target);
+          visitor.visitEdge(edge);
+          visitor.visitNode(target);
+          descended = true;
+          break;
         }
       }
-      // All children of this node have been visited or skipped, so remove
-      // from the stack.
-      visitStack.pop_back();
-      visitor.popNode();
+      if (!descended) {
+        visitStack.pop_back();
+        visitor.popNode();
+      }
     }
   }
 
+  TraversalContext ownContext;
+  TraversalContext &context;
+  GraphType const &graph;
   Visitor &visitor;
   EdgePredicate edgePredicate;
-  std::set<const NodeType *> visitedNodes;
   std::vector<VisitStackElement> visitStack;
 };
 
@@ -0,0 +1,110 @@
+#include "netlist/DriverIndex.hpp"
+
+#include <algorithm>
+#include <limits>
+
+using namespace slang::netlist;
+
+DriverIndex::DriverIndex(FrozenNetlist const &graph) {
+  // Number the distinct paths of the snapshot's symbols, so that records of
+  // the same path share a bucket. Path 0 stands for unannotated edges,
+  // which are not indexed.
+  auto const symbols = graph.getSymbols();
+  std::vector<std::string> names(symbols.size());
+  std::vector<uint32_t> pathOf(symbols.size(), 0);
+  // The first symbol of each path.
+  std::vector<uint32_t> paths(1, 0);
+  flat_hash_map<std::string_view, uint32_t> pathIndex;
+  for (uint32_t symbol = 1; symbol < symbols.size(); symbol++) {
+    names[symbol] = symbols[symbol]->getHierarchicalPath();
+    auto [it, inserted] = pathIndex.try_emplace(
+        names[symbol], static_cast<uint32_t>(paths.size()));
+    if (inserted) {
+      paths.push_back(symbol);
+    }
+    pathOf[symbol] = it->second;
+  }
+
+  // Bucket the edges by path with a counting sort, so that each bucket
+  // lists its edges in edge index order.
+  std::vector<uint32_t> offsets(paths.size() + 1, 0);
+  for (EdgeIndex e = 0; e < graph.numEdges(); e++) {
+    offsets[pathOf[graph.getSymbolIndex(e)] + 1]++;
+  }
+  offsets[1] = 0;
+  for (size_t i = 1; i < offsets.size(); i++) {
+    offsets[i] += offsets[i - 1];
+  }
+  entries.resize(offsets.back());
+  auto cursor = offsets;
+  for (EdgeIndex e = 0; e < graph.numEdges(); e++) {
+    auto path = pathOf[graph.getSymbolIndex(e)];
+    if (path == 0) {
+      continue;
+    }
+    auto bounds = graph.getBounds(e);
+    entries[cursor[path]++] = {bounds.lower(), bounds.upper(), 0, e};
+  }
+
+  buckets.reserve(paths.size());
+  for (size_t path = 1; path < paths.size(); path++) {
+    auto first = entries.begin() + offsets[path];
+    auto last = entries.begin() + offsets[path + 1];
+    // A stable sort keeps entries with equal lower bounds in edge order.
+    std::stable_sort(first, last, [](Entry const &a, Entry const &b) {
+      return a.lower < b.lower;
+    });
+    buildTree(std::span<Entry>(first, last));
+    buckets.emplace(std::move(names[paths[path]]),
+                    Bucket{offsets[path], offsets[path + 1] - offsets[path]});
+  }
+}
+
+auto DriverIndex::find(std::string_view path, DriverBitRange bounds) const
+    -> std::vector<EdgeIndex> {
+  std::vector<EdgeIndex> result;
+  auto it = buckets.find(path);
+  if (it == buckets.end()) {
+    return result;
+  }
+  auto bucket = std::span<Entry const>(entries).subspan(it->second.offset,
+                                                        it->second.size);
+  searchTree(bucket, bounds.lower(), bounds.upper(), result);
+  std::ranges::sort(result);
+  return result;
+}
+
+auto DriverIndex::buildTree(std::span<Entry> tree) -> int32_t {
+  if (tree.empty()) {
+    return std::numeric_limits<int32_t>::min();
+  }
+  auto const mid = tree.size() / 2;
+  auto &root = tree[mid];
+  root.subtreeUpper =
+      std::max({root.upper, buildTree(tree.first(mid)),
+                buildTree(tree.subspan(mid + 1))});
+  return root.subtreeUpper;
+}
+
+void DriverIndex::searchTree(std::span<Entry const> tree, int32_t lower,
+                             int32_t upper, std::vector<EdgeIndex> &result) {
+  // Skip a subtree whose ranges all end below the query. The depth of the
+  // recursion is logarithmic in the size of the bucket.
+  if (tree.empty()) {
+    return;
+  }
+  auto const mid = tree.size() / 2;
+  auto const &root = tree[mid];
+  if (root.subtreeUpper < lower) {
+    return;
+  }
+  searchTree(tree.first(mid), lower, upper, result);
+  // The root and the entries after it start above the query.
+  if (root.lower > upper) {
+    return;
+  }
+  if (root.upper >= lower) {
+    result.push_back(root.edge);
+  }
+  searchTree(tree.subspan(mid + 1), lower, upper, result);
+}
@@ -0,0 +1,115 @@
+#include "EdgeLinker.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace slang::netlist;
+
+namespace {
+
+/// Partition that owns @p node during a bulk link.
+auto partitionOf(NetlistNode const &node, size_t numPartitions) -> size_t {
+  return node.ID % numPartitions;
+}
+
+/// An edge created by the out-edge pass, tagged with the position of its
+/// record in the staging order.
+struct CreatedEdge {
+  size_t seq;
+  NetlistEdge *edge;
+};
+
+} // namespace
+
+template <typename OnCreate>
+void EdgeLinker::linkOutEdge(EdgeRecord const &record, OnCreate &&onCreate) {
+  auto &source = *record.source;
+  auto *edge = source.lookupOutEdge(*record.target);
+  if (edge == nullptr) {
+    edge = &source.appendOutEdge(*record.target);
+    onCreate(*edge);
+  }
+  if (!record.annotated) {
+    return;
+  }
+  if (!edge->setVariable(record.symbol, record.bounds)) {
+    // Existing edge carries a non-contiguous range for the same symbol;
+    // create a parallel edge to preserve exact bit-range accuracy.
+    auto &newEdge = source.appendOutEdge(*record.target);
+    newEdge.setVariable(record.symbol, record.bounds);
+    newEdge.setEdgeKind(record.edgeKind);
+    onCreate(newEdge);
+  } else {
+    edge->setEdgeKind(record.edgeKind);
+  }
+}
+
+void EdgeLinker::link(EdgeRecord const &record) {
+  linkOutEdge(record, [](NetlistEdge &edge) {
+    edge.getTargetNode().appendInEdge(edge);
+  });
+}
+
+void EdgeLinker::linkAll(std::vector<std::vector<EdgeRecord>> &buffers,
+                         BS::thread_pool<> &threadPool) {
+  auto const numBuffers = buffers.size();
+  auto const numParts =
+      std::max<size_t>(1, static_cast<size_t>(threadPool.get_thread_count()));
+
+  // Global position of each buffer's first record in the staging order.
+  std::vector<size_t> offsets(numBuffers + 1, 0);
+  for (size_t b = 0; b < numBuffers; ++b) {
+    offsets[b + 1] = offsets[b] + buffers[b].size();
+  }
+  if (offsets.back() == 0) {
+    buffers.clear();
+    return;
+  }
+
+  // Pass 1: split each buffer by source partition, preserving record order.
+  // bySource[b * numParts + p] lists the records of buffer b whose source
+  // lies in partition p.
+  std::vector<std::vector<uint32_t>> bySource(numBuffers * numParts);
+  threadPool.detach_loop(size_t{0}, numBuffers, [&](size_t b) {
+    auto const &records = buffers[b];
+    for (size_t i = 0; i < records.size(); ++i) {
+      bySource[b * numParts + partitionOf(*records[i].source, numParts)]
+          .push_back(static_cast<uint32_t>(i));
+    }
+  });
+  threadPool.wait();
+
+  // Pass 2: create out-edges. Each task owns one partition of source nodes
+  // and visits its records in staging order, so every source sees the same
+  // sequence of records as a sequential link would. New edges are split by
+  // target partition for the next pass: byTarget[p * numParts + q].
+  std::vector<std::vector<CreatedEdge>> byTarget(numParts * numParts);
+  threadPool.detach_loop(size_t{0}, numParts, [&](size_t p) {
+    for (size_t b = 0; b < numBuffers; ++b) {
+      for (auto i : bySource[b * numParts + p]) {
+        linkOutEdge(buffers[b][i], [&](NetlistEdge &edge) {
+          auto q = partitionOf(edge.getTargetNode(), numParts);
+          byTarget[p * numParts + q].push_back({offsets[b] + i, &edge});
+        });
+      }
+    }
+  });
+  threadPool.wait();
+  buffers.clear();
+  bySource.clear();
+
+  // Pass 3: register in-edges. Each task owns one partition of target nodes
+  // and appends in staging order, matching a sequential link.
+  threadPool.detach_loop(size_t{0}, numParts, [&](size_t q) {
+    std::vector<CreatedEdge> edges;
+    for (size_t p = 0; p < numParts; ++p) {
+      auto const &part = byTarget[p * numParts + q];
+      edges.insert(edges.end(), part.begin(), part.end());
+    }
+    std::ranges::sort(edges, {}, &CreatedEdge::seq);
+    for (auto const &created : edges) {
+      created.edge->getTargetNode().appendInEdge(*created.edge);
+    }
+  });
+  threadPool.wait();
+}
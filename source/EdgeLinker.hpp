@@ -0,0 +1,60 @@
+#pragma once
+
+#include <vector>
+
+#include <BS_thread_pool.hpp>
+
+#include "netlist/DriverBitRange.hpp"
+#include "netlist/NetlistEdge.hpp"
+#include "netlist/NetlistNode.hpp"
+#include "netlist/SymbolReference.hpp"
+
+#include "slang/ast/SemanticFacts.h"
+
+namespace slang::netlist {
+
+/// A dependency recorded by NetlistBuilder::addDependency, to be turned
+/// into a graph edge by EdgeLinker.
+struct EdgeRecord {
+  NetlistNode *source;
+  NetlistNode *target;
+  SymbolReference const *symbol = nullptr;
+  DriverBitRange bounds;
+  ast::EdgeKind edgeKind = ast::EdgeKind::None;
+  /// False for plain dependencies, which leave the edge unannotated.
+  bool annotated = false;
+};
+
+/// Materialises edge records as edges of the netlist graph.
+///
+/// Linking a record reuses the first edge from its source to its target,
+/// merging the symbol annotation into it, and only creates a parallel edge
+/// when the annotation cannot be merged (see NetlistEdge::setVariable).
+///
+/// During parallel builds, tasks stage their records in per-task buffers
+/// rather than mutating the graph, and linkAll() materialises them in bulk
+/// once the tasks have finished. Because out-edges of distinct sources and
+/// in-edges of distinct targets are independent, the bulk pass partitions
+/// the work by node and needs no locking.
+class EdgeLinker {
+public:
+  /// Link a single record into the graph. Not thread-safe.
+  static void link(EdgeRecord const &record);
+
+  /// Link every record in @p buffers, with the same result as calling
+  /// link() on each record in turn, buffer by buffer. Out-edges are created
+  /// in parallel with one task per partition of source nodes, then in-edges
+  /// are registered in parallel with one task per partition of target
+  /// nodes. The buffers are released on return.
+  static void linkAll(std::vector<std::vector<EdgeRecord>> &buffers,
+                      BS::thread_pool<> &threadPool);
+
+private:
+  /// Create or merge the out-edge for @p record on its source node, calling
+  /// @p onCreate with each newly-created edge. The target's in-edges are
+  /// left to the caller.
+  template <typename OnCreate>
+  static void linkOutEdge(EdgeRecord const &record, OnCreate &&onCreate);
+};
+
+} // namespace slang::netlist
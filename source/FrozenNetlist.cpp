@@ -0,0 +1,93 @@
+#include "netlist/FrozenNetlist.hpp"
+
+#include "slang/util/FlatMap.h"
+
+using namespace slang::netlist;
+
+FrozenNetlist::FrozenNetlist(
+    DirectedGraph<NetlistNode, NetlistEdge> const &graph)
+    : graph(graph) {
+  auto const numNodes = graph.numNodes();
+  SLANG_ASSERT(numNodes < null_index);
+
+  // Number the nodes densely in graph order, which is their graph index.
+  nodeKinds.reserve(numNodes);
+  for (auto const &node : graph) {
+    SLANG_ASSERT(node->getGraphIndex() == nodeKinds.size());
+    nodeKinds.push_back(node->kind);
+  }
+
+  // Out-edge CSR: edge indices are assigned in (source node, outEdges)
+  // order, so the out-edges of each node form a contiguous index range.
+  outOffsets.reserve(numNodes + 1);
+  inOffsets.reserve(numNodes + 1);
+  size_t numEdges = 0;
+  for (auto const &node : graph) {
+    outOffsets.push_back(static_cast<EdgeIndex>(numEdges));
+    numEdges += node->outDegree();
+  }
+  outOffsets.push_back(static_cast<EdgeIndex>(numEdges));
+  SLANG_ASSERT(numEdges < std::numeric_limits<EdgeIndex>::max());
+
+  edges.reserve(numEdges);
+  symbols.push_back(nullptr);
+
+  flat_hash_map<NetlistEdge const *, EdgeIndex> edgeIndex;
+  edgeIndex.reserve(numEdges);
+  flat_hash_map<SymbolReference const *, uint32_t> symbolIndex;
+  symbolIndex.emplace(nullptr, 0);
+
+  for (NodeIndex source = 0; source < numNodes; source++) {
+    for (auto const &edge : graph.getNode(source).getOutEdges()) {
+      edgeIndex.emplace(edge.get(), static_cast<EdgeIndex>(edges.size()));
+
+      auto [it, inserted] = symbolIndex.try_emplace(
+          edge->symbol, static_cast<uint32_t>(symbols.size()));
+      if (inserted) {
+        symbols.push_back(edge->symbol);
+      }
+      SLANG_ASSERT(it->second <= PackedEdge::symbolMask);
+
+      PackedEdge packed{};
+      packed.source = source;
+      packed.target =
+          static_cast<NodeIndex>(edge->getTargetNode().getGraphIndex());
+      packed.attributes =
+          it->second |
+          (static_cast<uint32_t>(edge->edgeKind) << PackedEdge::kindShift);
+      if (edge->disabled) {
+        packed.attributes |= PackedEdge::disabledBit;
+      }
+      auto left = edge->bounds.left;
+      auto right = edge->bounds.right;
+      if (left >= 0 && left <= 0xffff && right >= 0 && right <= 0xffff) {
+        packed.bounds = (static_cast<uint32_t>(left) << 16) |
+                        static_cast<uint32_t>(right);
+      } else {
+        packed.attributes |= PackedEdge::wideBoundsBit;
+        packed.bounds = static_cast<uint32_t>(wideBounds.size());
+        wideBounds.push_back(edge->bounds);
+      }
+      edges.push_back(packed);
+    }
+  }
+
+  // In-edge CSR over edge indices, in each node's inEdges order.
+  inEdgeIds.reserve(numEdges);
+  for (auto const &node : graph) {
+    inOffsets.push_back(static_cast<EdgeIndex>(inEdgeIds.size()));
+    for (auto const *edge : node->getInEdges()) {
+      inEdgeIds.push_back(edgeIndex.at(edge));
+    }
+  }
+  inOffsets.push_back(static_cast<EdgeIndex>(inEdgeIds.size()));
+}
+
+auto FrozenNetlist::memoryBytes() const -> size_t {
+  return nodeKinds.capacity() * sizeof(NodeKind) +
+         (outOffsets.capacity() + inOffsets.capacity() + inEdgeIds.capacity()) *
+             sizeof(EdgeIndex) +
+         edges.capacity() * sizeof(PackedEdge) +
+         symbols.capacity() * sizeof(SymbolReference const *) +
+         wideBounds.capacity() * sizeof(DriverBitRange);
+}
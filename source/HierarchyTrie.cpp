@@ -0,0 +1,410 @@
+#include "netlist/HierarchyTrie.hpp"
+
+#include "common/Wildcard.hpp"
+
+#include "slang/util/FlatMap.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <string>
+
+using namespace slang::netlist;
+
+namespace {
+
+/// A child of a trie node during construction.
+struct EdgeKey {
+  uint32_t parent;
+  std::string_view segment;
+
+  auto operator==(EdgeKey const &) const -> bool = default;
+};
+
+struct EdgeKeyHash {
+  auto operator()(EdgeKey const &key) const -> size_t {
+    return std::hash<std::string_view>{}(key.segment) ^
+           (static_cast<size_t>(key.parent) * 0x9e3779b97f4a7c15ULL);
+  }
+};
+
+/// One `.`-separated segment of a glob pattern.
+struct PatternSegment {
+  enum Kind { Literal, Glob, Recursive } kind;
+  /// The text of a literal segment.
+  std::string_view text;
+  /// The compiled pattern of a glob segment.
+  WildcardSet glob;
+};
+
+/// Return true if @p pattern has a recursive wildcard (`**` or `...`) at
+/// @p pos, and set @p length to its length.
+auto recursiveAt(std::string_view pattern, size_t pos, size_t &length)
+    -> bool {
+  auto rest = pattern.substr(pos);
+  if (rest.starts_with("**")) {
+    length = 2;
+    return true;
+  }
+  if (rest.starts_with("...")) {
+    length = 3;
+    return true;
+  }
+  return false;
+}
+
+/// Split @p pattern into segments. Return false if part of the pattern
+/// cannot be matched a segment at a time the way wildcardMatch reads it,
+/// such as a segment that mixes a recursive wildcard with other characters,
+/// leaving the segments before that part in @p segments.
+auto parsePattern(std::string_view pattern,
+                  std::vector<PatternSegment> &segments) -> bool {
+  size_t pos = 0;
+  size_t length = 0;
+  while (true) {
+    // wildcardMatch reads a `.` before a recursive wildcard as an optional
+    // boundary, unless the `.` ends the previous segment. At the start of
+    // the pattern that is an empty first segment; after a recursive
+    // wildcard, whose trailing `.` has been read already, it is left to
+    // wildcardMatch.
+    if ((segments.empty() ||
+         segments.back().kind == PatternSegment::Recursive) &&
+        pattern.substr(pos).starts_with('.') &&
+        recursiveAt(pattern, pos + 1, length)) {
+      if (!segments.empty()) {
+        return false;
+      }
+      segments.push_back({PatternSegment::Literal, {}, {}});
+      pos++;
+    }
+    // A recursive wildcard that is a whole segment.
+    if (recursiveAt(pattern, pos, length) &&
+        (pos + length == pattern.size() || pattern[pos + length] == '.')) {
+      if (pos + length == pattern.size() && segments.size() >= 2 &&
+          segments.back().kind == PatternSegment::Recursive) {
+        // In `a.**.**` the first wildcard absorbs both `.`s, so the pattern
+        // needs at least `a.` and does not match `a`.
+        return false;
+      }
+      segments.push_back({PatternSegment::Recursive, {}, {}});
+      pos += length;
+      if (pos == pattern.size()) {
+        return true;
+      }
+      pos++;
+      continue;
+    }
+    // Otherwise a literal or glob segment running up to the next `.`, which
+    // must not begin a `...`.
+    auto end = pos;
+    bool glob = false;
+    while (end < pattern.size() && pattern[end] != '.') {
+      if (recursiveAt(pattern, end, length)) {
+        return false;
+      }
+      glob |= pattern[end] == '*' || pattern[end] == '?';
+      end++;
+    }
+    if (end < pattern.size() && recursiveAt(pattern, end, length)) {
+      return false;
+    }
+    auto text = pattern.substr(pos, end - pos);
+    if (glob) {
+      segments.push_back({PatternSegment::Glob, {}, {}});
+      segments.back().glob.add(text);
+    } else {
+      segments.push_back({PatternSegment::Literal, text, {}});
+    }
+    if (end == pattern.size()) {
+      return true;
+    }
+    pos = end + 1;
+  }
+}
+
+} // namespace
+
+struct HierarchyTrie::Query {
+  /// The whole pattern, compiled if it is not simple.
+  WildcardSet pattern;
+  std::vector<PatternSegment> segments;
+  /// False if a segment of the pattern could not be split, in which case
+  /// \c segments stops short of the segment before it and the paths below
+  /// the trie nodes it reaches are checked against the whole pattern.
+  bool simple = true;
+  /// The (trie node, segment) states already explored.
+  flat_hash_set<uint64_t> states;
+  /// The trie nodes whose subtree has been checked against the pattern.
+  flat_hash_set<uint32_t> checked;
+  /// The matching trie nodes with graph nodes, without duplicates.
+  flat_hash_set<uint32_t> emitted;
+  std::vector<uint32_t> matches;
+  /// Scratch storage for the paths checked against the whole pattern.
+  std::string path;
+
+  void emit(TrieNode const &trieNode, uint32_t index) {
+    if (!trieNode.nodes.empty() && emitted.insert(index).second) {
+      matches.push_back(index);
+    }
+  }
+};
+
+HierarchyTrie::HierarchyTrie(NameIndex const &index)
+    : version(index.getVersion()) {
+  // Build the trie with nodes numbered in insertion order. The trie node of
+  // each scope is memoized by scope id, so a scope's path is walked only
+  // the first time one of its symbols is seen.
+  std::vector<TrieNode> built(1, TrieNode{});
+  flat_hash_map<EdgeKey, uint32_t, EdgeKeyHash> childOf;
+  constexpr auto unknown = std::numeric_limits<uint32_t>::max();
+  std::vector<uint32_t> scopeNodes;
+  auto childNode = [&](uint32_t parent, std::string_view segment) {
+    auto next = static_cast<uint32_t>(built.size());
+    auto [it, inserted] = childOf.try_emplace(EdgeKey{parent, segment}, next);
+    if (inserted) {
+      built.push_back(TrieNode{segment, parent, 0, 0, 0, nullptr, {}});
+    }
+    return it->second;
+  };
+  std::vector<SymbolScope const *> pending;
+  auto scopeNode = [&](SymbolScope const &scope) {
+    // Walk up to the nearest scope with a known trie node, then add the
+    // scopes below it on the way back down.
+    for (auto const *s = &scope; s->parent != nullptr; s = s->parent) {
+      if (s->id >= scopeNodes.size()) {
+        scopeNodes.resize(s->id + 1, unknown);
+      }
+      if (scopeNodes[s->id] != unknown) {
+        break;
+      }
+      pending.push_back(s);
+    }
+    while (!pending.empty()) {
+      auto const *s = pending.back();
+      pending.pop_back();
+      auto parent =
+          s->parent->parent == nullptr ? root : scopeNodes[s->parent->id];
+      scopeNodes[s->id] = childNode(parent, s->segment);
+    }
+    return scope.parent == nullptr ? root : scopeNodes[scope.id];
+  };
+  index.forEach([&](SymbolReference const &symbol, auto nodes) {
+    auto node = childNode(scopeNode(*symbol.scope), symbol.leaf);
+    built[node].symbol = &symbol;
+    built[node].nodes = nodes;
+  });
+
+  // Group the children of each node, sorted by segment.
+  std::vector<uint32_t> offsets(built.size() + 1, 0);
+  for (size_t i = 1; i < built.size(); i++) {
+    offsets[built[i].parent + 1]++;
+  }
+  for (size_t i = 1; i < offsets.size(); i++) {
+    offsets[i] += offsets[i - 1];
+  }
+  std::vector<uint32_t> childList(built.size() - 1);
+  auto cursor = offsets;
+  for (size_t i = 1; i < built.size(); i++) {
+    childList[cursor[built[i].parent]++] = static_cast<uint32_t>(i);
+  }
+  for (size_t i = 0; i < built.size(); i++) {
+    std::ranges::sort(childList.begin() + offsets[i],
+                      childList.begin() + offsets[i + 1], {},
+                      [&](uint32_t child) { return built[child].segment; });
+  }
+
+  // Lay the nodes out breadth-first, so that the children of each node are
+  // contiguous.
+  std::vector<uint32_t> order{root};
+  std::vector<uint32_t> renumber(built.size());
+  order.reserve(built.size());
+  for (size_t i = 0; i < order.size(); i++) {
+    renumber[order[i]] = static_cast<uint32_t>(i);
+    for (auto k = offsets[order[i]]; k < offsets[order[i] + 1]; k++) {
+      order.push_back(childList[k]);
+    }
+  }
+  trieNodes.reserve(built.size());
+  for (auto old : order) {
+    auto trieNode = built[old];
+    trieNode.parent = renumber[trieNode.parent];
+    trieNode.numChildren = offsets[old + 1] - offsets[old];
+    trieNode.firstChild =
+        trieNode.numChildren == 0 ? 0 : renumber[childList[offsets[old]]];
+    trieNodes.push_back(trieNode);
+  }
+
+  uint32_t rank = 0;
+  forEachInSubtree(root,
+                   [&](uint32_t index) { trieNodes[index].rank = rank++; });
+}
+
+auto HierarchyTrie::findChild(uint32_t node, std::string_view segment) const
+    -> uint32_t {
+  auto nodes = children(node);
+  auto it = std::ranges::lower_bound(nodes, segment, {}, &TrieNode::segment);
+  if (it == nodes.end() || it->segment != segment) {
+    return root;
+  }
+  return trieNodes[node].firstChild +
+         static_cast<uint32_t>(it - nodes.begin());
+}
+
+template <typename Visit>
+void HierarchyTrie::forEachInSubtree(uint32_t node, Visit &&visit) const {
+  std::vector<uint32_t> stack{node};
+  while (!stack.empty()) {
+    auto current = stack.back();
+    stack.pop_back();
+    visit(current);
+    auto const &trieNode = trieNodes[current];
+    // Push in reverse so that children are visited in segment order.
+    for (auto i = trieNode.numChildren; i > 0; i--) {
+      stack.push_back(trieNode.firstChild + i - 1);
+    }
+  }
+}
+
+void HierarchyTrie::matchFrom(Query &query, uint32_t node,
+                              size_t segment) const {
+  if (!query.states.insert((uint64_t{node} << 32) | segment).second) {
+    return;
+  }
+  if (segment == query.segments.size()) {
+    if (query.simple) {
+      query.emit(trieNodes[node], node);
+      return;
+    }
+    // Check each path in the subtree against the whole pattern, skipping
+    // subtrees that have already been checked.
+    if (query.checked.contains(node)) {
+      return;
+    }
+    forEachInSubtree(node, [&](uint32_t index) {
+      auto const &trieNode = trieNodes[index];
+      query.checked.insert(index);
+      if (trieNode.nodes.empty()) {
+        return;
+      }
+      query.path.clear();
+      trieNode.symbol->appendHierarchicalPath(query.path);
+      if (query.pattern.matches(query.path)) {
+        query.emit(trieNode, index);
+      }
+    });
+    return;
+  }
+
+  auto const &pattern = query.segments[segment];
+  switch (pattern.kind) {
+  case PatternSegment::Literal:
+    if (auto child = findChild(node, pattern.text); child != root) {
+      matchFrom(query, child, segment + 1);
+    }
+    break;
+  case PatternSegment::Glob:
+    for (uint32_t i = 0; i < trieNodes[node].numChildren; i++) {
+      auto child = trieNodes[node].firstChild + i;
+      if (pattern.glob.matches(trieNodes[child].segment)) {
+        matchFrom(query, child, segment + 1);
+      }
+    }
+    break;
+  case PatternSegment::Recursive:
+    // Zero segments, then one more.
+    matchFrom(query, node, segment + 1);
+    for (uint32_t i = 0; i < trieNodes[node].numChildren; i++) {
+      matchFrom(query, trieNodes[node].firstChild + i, segment);
+    }
+    break;
+  }
+}
+
+auto HierarchyTrie::match(std::string_view pattern) const
+    -> std::vector<NetlistNode *> {
+  Query query;
+  query.simple = parsePattern(pattern, query.segments);
+  if (!query.simple) {
+    query.pattern.add(pattern);
+    // A recursive wildcard at the start of the unsplit segment can absorb
+    // the `.` before it, joining it to the previous segment, so that
+    // segment is checked with the rest of the pattern.
+    if (!query.segments.empty()) {
+      query.segments.pop_back();
+    }
+  }
+  matchFrom(query, root, 0);
+
+  std::ranges::sort(query.matches, {},
+                    [&](uint32_t index) { return trieNodes[index].rank; });
+  std::vector<NetlistNode *> result;
+  for (auto index : query.matches) {
+    auto nodes = trieNodes[index].nodes;
+    result.insert(result.end(), nodes.begin(), nodes.end());
+  }
+  return result;
+}
+
+auto HierarchyTrie::inScope(std::string_view scope) const
+    -> std::vector<NetlistNode *> {
+  std::vector<NetlistNode *> result;
+  uint32_t node = root;
+  size_t start = 0;
+  while (true) {
+    auto dot = scope.find('.', start);
+    node = findChild(
+        node, scope.substr(start, dot == std::string_view::npos
+                                      ? dot
+                                      : dot - start));
+    if (node == root) {
+      return result;
+    }
+    if (dot == std::string_view::npos) {
+      break;
+    }
+    start = dot + 1;
+  }
+  forEachInSubtree(node, [&](uint32_t index) {
+    auto nodes = trieNodes[index].nodes;
+    result.insert(result.end(), nodes.begin(), nodes.end());
+  });
+  return result;
+}
+
+auto HierarchyTrie::withPrefix(std::string_view prefix) const
+    -> std::vector<Entry> {
+  std::vector<Entry> result;
+  // Descend the complete segments of the prefix.
+  uint32_t node = root;
+  auto last = prefix.rfind('.');
+  if (last != std::string_view::npos) {
+    size_t start = 0;
+    while (true) {
+      auto dot = prefix.find('.', start);
+      node = findChild(node, prefix.substr(start, dot - start));
+      if (node == root) {
+        return result;
+      }
+      if (dot == last) {
+        break;
+      }
+      start = dot + 1;
+    }
+  }
+  // The children whose segment begins with the rest of the prefix are
+  // contiguous, since children are sorted by segment.
+  auto partial = prefix.substr(last == std::string_view::npos ? 0 : last + 1);
+  auto nodes = children(node);
+  auto it = std::ranges::lower_bound(nodes, partial, {}, &TrieNode::segment);
+  for (; it != nodes.end() && it->segment.starts_with(partial); ++it) {
+    auto child = trieNodes[node].firstChild +
+                 static_cast<uint32_t>(it - nodes.begin());
+    forEachInSubtree(child, [&](uint32_t index) {
+      auto const &trieNode = trieNodes[index];
+      if (!trieNode.nodes.empty()) {
+        result.push_back({trieNode.symbol, trieNode.nodes});
+      }
+    });
+  }
+  return result;
+}
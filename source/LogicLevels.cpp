@@ -0,0 +1,283 @@
+#include "netlist/LogicLevels.hpp"
+
+#include "netlist/SequentialGraph.hpp"
+
+#include "QueryPool.hpp"
+#include "StronglyConnectedComponents.hpp"
+
+#include "slang/util/FlatMap.h"
+#include "slang/util/Util.h"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <limits>
+#include <utility>
+
+using namespace slang::netlist;
+
+namespace {
+
+constexpr auto none = std::numeric_limits<uint32_t>::max();
+
+/// Frontiers with fewer components than this are processed on the calling
+/// thread.
+constexpr size_t parallelThreshold = 4096;
+
+/// Number of components of a frontier each task processes.
+constexpr size_t componentsPerTask = 1024;
+
+/// Return true if @p node computes a value, rather than holding one or
+/// joining the values of control-flow branches.
+auto isLogic(NetlistNode const &node) -> bool {
+  return node.kind == NodeKind::Assignment ||
+         node.kind == NodeKind::Conditional || node.kind == NodeKind::Case;
+}
+
+/// Return true if @p edge is a data edge into a State node, as opposed to
+/// a clock or reset edge.
+auto isStateData(NetlistEdge const &edge) -> bool {
+  return !edge.disabled && edge.edgeKind == slang::ast::EdgeKind::None;
+}
+
+} // namespace
+
+LogicLevels::LogicLevels(NetlistGraph const &graph)
+    : graph(graph), version(graph.getNodeListVersion()) {
+  SLANG_ASSERT(!graph.hasReleasedEdges());
+  auto const numNodes = graph.numNodes();
+
+  // The combinational edges: enabled, and not into a State node. The
+  // predecessor lists are count sorted from the successor lists.
+  firstSuccessor.reserve(numNodes + 1);
+  firstSuccessor.push_back(0);
+  for (auto const &node : graph) {
+    for (auto const &edge : node->getOutEdges()) {
+      auto const &target = edge->getTargetNode();
+      if (!edge->disabled && target.kind != NodeKind::State) {
+        successors.push_back(static_cast<uint32_t>(target.getGraphIndex()));
+      }
+    }
+    firstSuccessor.push_back(static_cast<uint32_t>(successors.size()));
+  }
+  firstPredecessor.assign(numNodes + 1, 0);
+  for (auto target : successors) {
+    firstPredecessor[target + 1]++;
+  }
+  for (size_t n = 0; n < numNodes; n++) {
+    firstPredecessor[n + 1] += firstPredecessor[n];
+  }
+  predecessors.resize(successors.size());
+  auto nextPredecessor = firstPredecessor;
+  for (uint32_t node = 0; node < numNodes; node++) {
+    for (auto e = firstSuccessor[node]; e < firstSuccessor[node + 1]; e++) {
+      predecessors[nextPredecessor[successors[e]]++] = node;
+    }
+  }
+
+  StronglyConnectedComponents scc(firstSuccessor, successors);
+  auto const numComponents = scc.numComponents;
+  std::vector<uint32_t> firstMember;
+  std::vector<uint32_t> members;
+  scc.groupMembers(firstMember, members);
+  components = std::move(scc.components);
+
+  // The number of logic nodes in each component, and the number of edges
+  // into it from other components that are yet to be processed.
+  std::vector<uint32_t> weights(numComponents, 0);
+  std::vector<uint32_t> pending(numComponents, 0);
+  for (uint32_t node = 0; node < numNodes; node++) {
+    auto const c = components[node];
+    weights[c] += isLogic(graph.getNode(node)) ? 1 : 0;
+    for (auto e = firstSuccessor[node]; e < firstSuccessor[node + 1]; e++) {
+      auto const target = components[successors[e]];
+      if (target != c) {
+        pending[target]++;
+      }
+    }
+  }
+
+  // Process a component whose predecessors are all done: take its level
+  // from the highest of them, and add each successor whose last pending
+  // edge this was to the next frontier. Components of one frontier share
+  // no edges, so only the pending counts are written concurrently.
+  levels.assign(numComponents, 0);
+  entrySources.assign(numComponents, none);
+  entryTargets.assign(numComponents, none);
+  auto visit = [&](uint32_t c, std::vector<uint32_t> &next) {
+    uint32_t level = 0;
+    for (auto m = firstMember[c]; m < firstMember[c + 1]; m++) {
+      auto const node = members[m];
+      for (auto e = firstPredecessor[node]; e < firstPredecessor[node + 1];
+           e++) {
+        auto const source = predecessors[e];
+        auto const from = components[source];
+        if (from != c && (entrySources[c] == none || levels[from] > level)) {
+          level = levels[from];
+          entrySources[c] = source;
+          entryTargets[c] = node;
+        }
+      }
+    }
+    levels[c] = level + weights[c];
+    for (auto m = firstMember[c]; m < firstMember[c + 1]; m++) {
+      auto const node = members[m];
+      for (auto e = firstSuccessor[node]; e < firstSuccessor[node + 1]; e++) {
+        auto const target = components[successors[e]];
+        if (target == c) {
+          continue;
+        }
+        std::atomic_ref<uint32_t> count(pending[target]);
+        if (count.fetch_sub(1, std::memory_order_relaxed) == 1) {
+          next.push_back(target);
+        }
+      }
+    }
+  };
+
+  std::vector<uint32_t> frontier;
+  for (uint32_t c = 0; c < numComponents; c++) {
+    if (pending[c] == 0) {
+      frontier.push_back(c);
+    }
+  }
+  auto &pool = graph.getQueryPool();
+  std::vector<std::vector<uint32_t>> blockFrontiers;
+  std::vector<uint32_t> next;
+  while (!frontier.empty()) {
+    frontierCount++;
+    next.clear();
+    if (frontier.size() >= parallelThreshold && !pool.isSerial()) {
+      auto const numBlocks =
+          (frontier.size() + componentsPerTask - 1) / componentsPerTask;
+      blockFrontiers.resize(numBlocks);
+      pool.forEach(numBlocks, [&](size_t block) {
+        auto &blockNext = blockFrontiers[block];
+        blockNext.clear();
+        auto end = std::min(frontier.size(), (block + 1) * componentsPerTask);
+        for (auto i = block * componentsPerTask; i < end; i++) {
+          visit(frontier[i], blockNext);
+        }
+      });
+      for (size_t block = 0; block < numBlocks; block++) {
+        next.insert(next.end(), blockFrontiers[block].begin(),
+                    blockFrontiers[block].end());
+      }
+    } else {
+      for (auto c : frontier) {
+        visit(c, next);
+      }
+    }
+    std::swap(frontier, next);
+  }
+  SLANG_ASSERT(std::ranges::all_of(pending, [](auto n) { return n == 0; }));
+
+  if (!levels.empty()) {
+    highestLevel = std::ranges::max(levels);
+  }
+}
+
+auto LogicLevels::getDepth(NetlistNode const &node) const -> uint32_t {
+  SLANG_ASSERT(graph.getNodeListVersion() == version);
+  if (node.kind != NodeKind::State) {
+    return getLevel(node);
+  }
+  uint32_t depth = 0;
+  for (auto const *edge : node.getInEdges()) {
+    if (isStateData(*edge)) {
+      depth = std::max(depth, getLevel(edge->getSourceNode()));
+    }
+  }
+  return depth;
+}
+
+auto LogicLevels::getEndpointsByDepth() const -> std::vector<NetlistNode *> {
+  SLANG_ASSERT(graph.getNodeListVersion() == version);
+  std::vector<std::pair<uint32_t, NetlistNode *>> endpoints;
+  for (auto const &node : graph) {
+    if (SequentialGraph::isEndpoint(*node)) {
+      endpoints.emplace_back(getDepth(*node), node.get());
+    }
+  }
+  std::ranges::stable_sort(endpoints, [](auto const &a, auto const &b) {
+    return a.first > b.first;
+  });
+  std::vector<NetlistNode *> result;
+  result.reserve(endpoints.size());
+  for (auto const &[depth, node] : endpoints) {
+    result.push_back(node);
+  }
+  return result;
+}
+
+void LogicLevels::tracePath(uint32_t node, std::vector<uint32_t> &path) const {
+  // Collect the nodes from the end back, then reverse them.
+  auto const first = path.size();
+  path.push_back(node);
+  flat_hash_map<uint32_t, uint32_t> towardNode;
+  std::deque<uint32_t> queue;
+  for (;;) {
+    auto const c = components[node];
+    auto const entry = entryTargets[c];
+    if (entry == none) {
+      break;
+    }
+
+    // Route back through the loop from the node to where the path enters
+    // it, searching breadth-first within the component.
+    if (entry != node) {
+      towardNode.clear();
+      towardNode.emplace(node, none);
+      queue.assign(1, node);
+      while (!towardNode.contains(entry)) {
+        SLANG_ASSERT(!queue.empty());
+        auto const current = queue.front();
+        queue.pop_front();
+        for (auto e = firstPredecessor[current];
+             e < firstPredecessor[current + 1]; e++) {
+          auto const source = predecessors[e];
+          if (components[source] == c &&
+              towardNode.emplace(source, current).second) {
+            queue.push_back(source);
+          }
+        }
+      }
+      auto const loopStart = path.size();
+      for (auto n = entry; n != node; n = towardNode.at(n)) {
+        path.push_back(n);
+      }
+      std::reverse(path.begin() + static_cast<std::ptrdiff_t>(loopStart),
+                   path.end());
+    }
+    node = entrySources[c];
+    path.push_back(node);
+  }
+  std::reverse(path.begin() + static_cast<std::ptrdiff_t>(first), path.end());
+}
+
+auto LogicLevels::getDeepestPath(NetlistNode &node) const -> NetlistPath {
+  std::vector<uint32_t> indices;
+  auto const end = indexOf(node);
+  if (node.kind == NodeKind::State) {
+    // Extend the deepest path to the data input with the highest level.
+    NetlistNode const *driver = nullptr;
+    for (auto const *edge : node.getInEdges()) {
+      auto const &source = edge->getSourceNode();
+      if (isStateData(*edge) &&
+          (driver == nullptr || getLevel(source) > getLevel(*driver))) {
+        driver = &source;
+      }
+    }
+    if (driver != nullptr) {
+      tracePath(indexOf(*driver), indices);
+    }
+    indices.push_back(end);
+  } else {
+    tracePath(end, indices);
+  }
+  NetlistPath path;
+  for (auto index : indices) {
+    path.add(graph.getNode(index));
+  }
+  return path;
+}
@@ -0,0 +1,105 @@
+#include "netlist/NameIndex.hpp"
+
+#include "QueryPool.hpp"
+
+#include <algorithm>
+#include <utility>
+
+using namespace slang::netlist;
+
+namespace {
+
+/// Tables smaller than this are indexed on the calling thread.
+constexpr size_t parallelThreshold = size_t{1} << 14;
+
+/// Number of rows each task of the first pass assigns to shards.
+constexpr size_t rowsPerTask = size_t{1} << 13;
+
+} // namespace
+
+NameIndex::NameIndex(NodeTable const &table, SymbolTable const &symbolTable,
+                     QueryPool &pool)
+    : symbols(symbolTable), version(table.getVersion()) {
+  auto const numRows = table.size();
+  auto const parallel = numRows >= parallelThreshold && !pool.isSerial();
+  auto const numParts = parallel ? pool.getThreadCount() : 1;
+  shards.resize(numParts);
+
+  // Run body(i) for i in [0, count), in parallel on large tables.
+  auto forEach = [&](size_t count, auto &&body) {
+    if (parallel) {
+      pool.forEach(count, body);
+    } else {
+      for (size_t i = 0; i < count; i++) {
+        body(i);
+      }
+    }
+  };
+
+  // Pass 1: assign the named rows of each block of rows to shards,
+  // preserving row order. byShard[b * numParts + s] lists the rows of block
+  // b that belong to shard s.
+  auto const rowSymbols = table.getSymbols();
+  auto const numBlocks = (numRows + rowsPerTask - 1) / rowsPerTask;
+  std::vector<std::vector<uint32_t>> byShard(numBlocks * numParts);
+  forEach(numBlocks, [&](size_t b) {
+    auto end = std::min(numRows, (b + 1) * rowsPerTask);
+    for (auto row = b * rowsPerTask; row < end; row++) {
+      if (rowSymbols[row] != nullptr) {
+        byShard[b * numParts + shardOf(SymbolTable::keyOf(*rowSymbols[row]))]
+            .push_back(static_cast<uint32_t>(row));
+      }
+    }
+  });
+
+  // Pass 2: build each shard from its rows, taken block by block so that
+  // they are in graph order. A stable sort by key then groups the nodes of
+  // each path into one range without reordering them.
+  forEach(numParts, [&](size_t s) {
+    std::vector<uint32_t> rows;
+    for (size_t b = 0; b < numBlocks; b++) {
+      auto const &part = byShard[b * numParts + s];
+      rows.insert(rows.end(), part.begin(), part.end());
+    }
+    std::ranges::stable_sort(rows, {}, [&](uint32_t row) {
+      auto key = SymbolTable::keyOf(*rowSymbols[row]);
+      return std::pair(key.scope, key.leaf);
+    });
+    auto &shard = shards[s];
+    shard.nodes.reserve(rows.size());
+    for (auto row : rows) {
+      auto offset = static_cast<uint32_t>(shard.nodes.size());
+      auto it = shard.ranges
+                    .try_emplace(SymbolTable::keyOf(*rowSymbols[row]),
+                                 Range{rowSymbols[row], offset, 0})
+                    .first;
+      it->second.size++;
+      shard.nodes.push_back(&table.getNode(row));
+    }
+  });
+}
+
+auto NameIndex::find(std::string_view path) const
+    -> std::span<NetlistNode *const> {
+  auto [scopePath, leaf] = SymbolTable::splitPath(path);
+  auto const *scope = symbols.findScope(scopePath);
+  if (scope == nullptr) {
+    return {};
+  }
+  SymbolTable::Key key{scope->id, leaf};
+  auto const &shard = shards[shardOf(key)];
+  auto it = shard.ranges.find(key);
+  if (it == shard.ranges.end()) {
+    return {};
+  }
+  return std::span<NetlistNode *const>(shard.nodes)
+      .subspan(it->second.offset, it->second.size);
+}
+
+auto NameIndex::size() const -> size_t {
+  size_t count = 0;
+  for (auto const &shard : shards) {
+    count += shard.ranges.size();
+  }
+  return count;
+}
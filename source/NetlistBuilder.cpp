@@ -1,7 +1,6 @@
 #include "NetlistBuilder.hpp"
 #include "BitSliceList.hpp"
 #include "DataFlowAnalysis.hpp"
-#include "common/Wildcard.hpp"
 
 #include "common/Utilities.hpp"
 
@@ -37,7 +36,7 @@ NetlistBuilder::NetlistBuilder(ast::Compilation &compilation,
                                analysis::AnalysisManager &analysisManager,
                                NetlistGraph &graph, BuilderOptions options)
     : compilation(compilation), analysisManager(analysisManager), graph(graph),
-      options(options) {
+      options(options), blackBoxPatterns(this->options.blackBoxes) {
   NetlistNode::nextID.store(1, std::memory_order_relaxed);
 }
 
@@ -67,7 +66,7 @@ void NetlistBuilder::build(const ast::Symbol &root) { pipeline.run(root); }
 void NetlistBuilder::finalize() { pipeline.finalize(); }
 
 void NetlistBuilder::addDependency(NetlistNode &source, NetlistNode &target) {
-  source.addEdge(target);
+  stageOrLink({.source = &source, .target = &target});
 }
 
 void NetlistBuilder::addDependency(NetlistNode &source, NetlistNode &target,
@@ -90,18 +89,25 @@ void NetlistBuilder::addDependency(NetlistNode &source, NetlistNode &target,
 
   DEBUG_PRINT("New edge {} from node {} to node {} via {}{}\n",
               toString(edgeKind), source.ID, target.ID,
-              symbol != nullptr ? symbol->hierarchicalPath : std::string{},
+              symbol != nullptr ? symbol->getHierarchicalPath() : std::string{},
               toString(edgeBounds));
 
-  auto &edge = source.addEdge(target);
-  if (!edge.setVariable(symbol, edgeBounds)) {
-    // Existing edge carries a non-contiguous range for the same symbol;
-    // create a parallel edge to preserve exact bit-range accuracy.
-    auto &newEdge = source.addNewEdge(target);
-    newEdge.setVariable(symbol, edgeBounds);
-    newEdge.setEdgeKind(edgeKind);
+  stageOrLink({.source = &source,
+               .target = &target,
+               .symbol = symbol,
+               .bounds = edgeBounds,
+               .edgeKind = edgeKind,
+               .annotated = true});
+}
+
+void NetlistBuilder::stageOrLink(EdgeRecord const &record) {
+  // Inside a parallel task, stage the edge so that the task never mutates
+  // nodes shared with other tasks; the staged edges are linked in bulk
+  // once the tasks have finished.
+  if (auto *work = pendingQueue.getTaskBuffer()) {
+    work->edges.push_back(record);
   } else {
-    edge.setEdgeKind(edgeKind);
+    EdgeLinker::link(record);
   }
 }
 
@@ -249,8 +255,7 @@ auto NetlistBuilder::merge(NetlistNode &a, NetlistNode &b) -> NetlistNode & {
     return a;
   }
 
-  auto mergeNode = std::make_unique<Merge>();
-  auto &node = graph.addNode(std::move(mergeNode));
+  auto &node = graph.emplaceNode<Merge>();
   addDependency(a, node);
   addDependency(b, node);
   return node;
@@ -457,22 +462,11 @@ void NetlistBuilder::handle(ast::VariableSymbol const &symbol) {
 
 bool NetlistBuilder::isBlackBoxInstance(
     ast::InstanceSymbol const &symbol) const {
-  if (options.blackBoxes.empty()) {
+  if (blackBoxPatterns.empty()) {
     return false;
   }
-  auto const defName = std::string(symbol.getDefinition().name);
-  for (auto const &pattern : options.blackBoxes) {
-    if (wildcardMatch(defName.c_str(), pattern.c_str())) {
-      return true;
-    }
-  }
-  auto const path = symbol.getHierarchicalPath();
-  for (auto const &pattern : options.blackBoxes) {
-    if (wildcardMatch(path.c_str(), pattern.c_str())) {
-      return true;
-    }
-  }
-  return false;
+  return blackBoxPatterns.matches(symbol.getDefinition().name) ||
+         blackBoxPatterns.matches(symbol.getHierarchicalPath());
 }
 
 void NetlistBuilder::handle(ast::InstanceSymbol const &symbol) {
@@ -12,12 +12,14 @@
 #include "BitSliceList.hpp"
 #include "BuildPipeline.hpp"
 #include "CanonicalBodyResolver.hpp"
+#include "EdgeLinker.hpp"
 #include "NodeFactory.hpp"
 #include "PendingRvalueQueue.hpp"
 #include "PortConnectionHandler.hpp"
 #include "ValueTracker.hpp"
 #include "VariableTracker.hpp"
 
+#include "common/Wildcard.hpp"
 #include "netlist/BuildProfile.hpp"
 #include "netlist/BuilderOptions.hpp"
 #include "netlist/Debug.hpp"
@@ -66,6 +68,9 @@ class NetlistBuilder
   /// Caller-supplied build options.
   BuilderOptions options;
 
+  /// The `options.blackBoxes` patterns, compiled once.
+  WildcardSet blackBoxPatterns;
+
   /// Resolves AST symbols to their canonical counterparts so driver
   /// queries against slang's AnalysisManager redirect correctly.
   CanonicalBodyResolver canonicalResolver;
@@ -187,6 +192,10 @@ private:
                      SymbolReference const *symbol, DriverBitRange bounds,
                      ast::EdgeKind edgeKind = ast::EdgeKind::None);
 
+  /// Stage @p record in the current task's buffer during a parallel build,
+  /// or link it into the graph immediately otherwise.
+  void stageOrLink(EdgeRecord const &record);
+
   /// Add a list of drivers to the target node. Annotate the edges with the
   /// driven symbol and its bounds.
   void addDriversToNode(DriverList const &drivers, NetlistNode &node,
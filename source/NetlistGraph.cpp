@@ -1,12 +1,20 @@
 #include "netlist/NetlistGraph.hpp"
 
+#include "BitTraversal.hpp"
 #include "DepthFirstSearch.hpp"
 #include "NetlistBuilder.hpp"
-#include "common/Wildcard.hpp"
+#include "QueryPool.hpp"
+#include "StronglyConnectedComponents.hpp"
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <regex>
 #include <string>
 #include <string_view>
@@ -15,43 +23,158 @@
 
 using namespace slang::netlist;
 
+NetlistGraph::NetlistGraph() = default;
+NetlistGraph::~NetlistGraph() = default;
+
+void NetlistGraph::setBuildProfile(BuildProfile const &profile) {
+  buildProfile = profile;
+  queryPool.reset();
+}
+
 void NetlistGraph::build(ast::Compilation &compilation,
                          analysis::AnalysisManager &analysisManager,
                          BuilderOptions options) {
+  unfreeze();
   NetlistBuilder builder(compilation, analysisManager, *this, options);
   builder.build(compilation.getRoot());
   builder.finalize();
-  setBuildProfile(builder.getBuildProfile());
+  auto profile = builder.getBuildProfile();
+  if (options.simplify) {
+    auto t = std::chrono::steady_clock::now();
+    profile.contractedNodeCount = contractPassThroughNodes();
+    profile.simplifySeconds = std::chrono::duration<double>(
+                                  std::chrono::steady_clock::now() - t)
+                                  .count();
+  }
+  setBuildProfile(profile);
 }
 
-void NetlistGraph::buildIndex() const {
-  if (indexBuilt)
-    return;
-  for (auto const &node : nodes) {
-    auto path = node->getHierarchicalPath();
-    if (path.has_value()) {
-      nodeIndex[std::string(*path)].push_back(node.get());
+void NetlistGraph::freeze(bool releaseEdges) {
+  unfreeze();
+  frozen = std::make_unique<FrozenNetlist>(*this);
+  if (releaseEdges) {
+    releaseAllEdges();
+    edgesReleased = true;
+  }
+}
+
+void NetlistGraph::unfreeze() {
+  if (edgesReleased) {
+    restoreEdges();
+  }
+  driverIndex.reset();
+  frozen.reset();
+}
+
+void NetlistGraph::restoreEdges() {
+  SLANG_ASSERT(frozen && frozen->numNodes() == numNodes());
+  using NodeIndex = FrozenNetlist::NodeIndex;
+  // Recreate the out-edges of each node in order, which gives each edge its
+  // snapshot index, then register them with their targets in the order of
+  // each node's in-edges.
+  std::vector<NetlistEdge *> edges(frozen->numEdges());
+  for (NodeIndex n = 0; n < frozen->numNodes(); n++) {
+    auto &source = getNode(n);
+    for (auto e : frozen->outEdges(n)) {
+      auto &edge = source.appendOutEdge(getNode(frozen->getTarget(e)));
+      edge.edgeKind = frozen->getEdgeKind(e);
+      edge.symbol = frozen->getSymbol(e);
+      edge.bounds = frozen->getBounds(e);
+      edge.disabled = frozen->isDisabled(e);
+      edges[e] = &edge;
     }
   }
-  indexBuilt = true;
+  for (NodeIndex n = 0; n < frozen->numNodes(); n++) {
+    auto &target = getNode(n);
+    for (auto e : frozen->inEdges(n)) {
+      target.appendInEdge(*edges[e]);
+    }
+  }
+  edgesReleased = false;
+}
+
+auto NetlistGraph::getNodeTable() const -> NodeTable const & {
+  std::lock_guard lock(lazyMutex);
+  return getNodeTableLocked();
+}
+
+auto NetlistGraph::getNodeTableLocked() const -> NodeTable const & {
+  if (!nodeTable || nodeTable->getVersion() != getNodeListVersion()) {
+    nodeTable = std::make_unique<NodeTable>(*this);
+  }
+  return *nodeTable;
+}
+
+auto NetlistGraph::getQueryPool() const -> QueryPool & {
+  std::lock_guard lock(lazyMutex);
+  return getQueryPoolLocked();
+}
+
+auto NetlistGraph::getQueryPoolLocked() const -> QueryPool & {
+  if (!queryPool) {
+    queryPool = std::make_unique<QueryPool>(buildProfile.numThreads);
+  }
+  return *queryPool;
+}
+
+auto NetlistGraph::getNameIndex() const -> NameIndex const & {
+  std::lock_guard lock(lazyMutex);
+  return getNameIndexLocked();
+}
+
+auto NetlistGraph::getNameIndexLocked() const -> NameIndex const & {
+  if (!nameIndex || nameIndex->getVersion() != getNodeListVersion()) {
+    nameIndex = std::make_unique<NameIndex>(getNodeTableLocked(), symbolTable,
+                                            getQueryPoolLocked());
+  }
+  return *nameIndex;
+}
+
+auto NetlistGraph::getHierarchyTrie() const -> HierarchyTrie const & {
+  std::lock_guard lock(lazyMutex);
+  if (!hierarchyTrie || hierarchyTrie->getVersion() != getNodeListVersion()) {
+    hierarchyTrie = std::make_unique<HierarchyTrie>(getNameIndexLocked());
+  }
+  return *hierarchyTrie;
+}
+
+void NetlistGraph::buildIndexes() const {
+  static_cast<void>(getHierarchyTrie());
+  if (frozen) {
+    static_cast<void>(getDriverIndex());
+  }
+}
+
+auto NetlistGraph::getSequentialGraph() const -> SequentialGraph const & {
+  std::lock_guard lock(lazyMutex);
+  if (!sequentialGraph ||
+      sequentialGraph->getVersion() != getNodeListVersion()) {
+    sequentialGraph =
+        std::make_unique<SequentialGraph>(*this, getQueryPoolLocked());
+  }
+  return *sequentialGraph;
+}
+
+auto NetlistGraph::getDriverIndex() const -> DriverIndex const & {
+  SLANG_ASSERT(frozen);
+  std::lock_guard lock(lazyMutex);
+  if (!driverIndex) {
+    driverIndex = std::make_unique<DriverIndex>(*frozen);
+  }
+  return *driverIndex;
 }
 
 auto NetlistGraph::lookup(std::string_view name) const -> NetlistNode * {
-  buildIndex();
-  auto it = nodeIndex.find(std::string(name));
-  if (it == nodeIndex.end() || it->second.empty())
+  auto nodes = getNameIndex().find(name);
+  if (nodes.empty())
     return nullptr;
-  return it->second.front();
+  return nodes.front();
 }
 
 auto NetlistGraph::lookup(std::string_view name, DriverBitRange bounds) const
     -> std::vector<NetlistNode *> {
-  buildIndex();
   std::vector<NetlistNode *> result;
-  auto it = nodeIndex.find(std::string(name));
-  if (it == nodeIndex.end())
-    return result;
-  for (auto *node : it->second) {
+  for (auto *node : getNameIndex().find(name)) {
     auto nodeBounds = node->getBounds();
     if (nodeBounds.has_value() && nodeBounds->overlaps(bounds)) {
       result.push_back(node);
@@ -65,9 +188,18 @@ auto NetlistGraph::getDrivers(std::string_view name,
     -> std::vector<NetlistNode *> {
   std::unordered_set<NetlistNode *> seen;
   std::vector<NetlistNode *> result;
+  if (frozen) {
+    for (auto e : getDriverIndex().find(name, bounds)) {
+      auto *source = &frozen->getNode(frozen->getSource(e));
+      if (seen.insert(source).second) {
+        result.push_back(source);
+      }
+    }
+    return result;
+  }
   for (auto const &node : nodes) {
     for (auto const &edge : node->getOutEdges()) {
-      if (edge->symbol == nullptr || edge->symbol->hierarchicalPath != name) {
+      if (edge->symbol == nullptr || !edge->symbol->hasPath(name)) {
         continue;
       }
       if (!edge->bounds.overlaps(bounds)) {
@@ -86,16 +218,25 @@ auto NetlistGraph::getBitDrivers(std::string_view name,
                                  DriverBitRange bounds) const
     -> std::vector<BitDriver> {
   std::vector<BitDriver> result;
-  for (auto const &node : nodes) {
-    for (auto const &edge : node->getOutEdges()) {
-      if (edge->symbol == nullptr || edge->symbol->hierarchicalPath != name) {
-        continue;
-      }
-      auto clipped = edge->bounds.intersection(bounds);
-      if (!clipped.has_value()) {
-        continue;
+  if (frozen) {
+    for (auto e : getDriverIndex().find(name, bounds)) {
+      auto clipped = frozen->getBounds(e).intersection(bounds);
+      SLANG_ASSERT(clipped.has_value());
+      result.push_back(
+          BitDriver{*clipped, &frozen->getNode(frozen->getSource(e))});
+    }
+  } else {
+    for (auto const &node : nodes) {
+      for (auto const &edge : node->getOutEdges()) {
+        if (edge->symbol == nullptr || !edge->symbol->hasPath(name)) {
+          continue;
+        }
+        auto clipped = edge->bounds.intersection(bounds);
+        if (!clipped.has_value()) {
+          continue;
+        }
+        result.push_back(BitDriver{*clipped, &edge->getSourceNode()});
       }
-      result.push_back(BitDriver{*clipped, &edge->getSourceNode()});
     }
   }
   auto key = [](BitDriver const &b) {
@@ -126,12 +267,22 @@ struct CombFanPredicate {
   bool operator()(const NetlistEdge &edge) const {
     return !edge.disabled && edge.getTargetNode().kind != NodeKind::State;
   }
+  bool operator()(FrozenNetlist const &graph,
+                  FrozenNetlist::EdgeIndex edge) const {
+    return !graph.isDisabled(edge) &&
+           graph.getKind(graph.getTarget(edge)) != NodeKind::State;
+  }
 };
 
 struct CombFanBackwardPredicate {
   bool operator()(const NetlistEdge &edge) const {
     return !edge.disabled && edge.getSourceNode().kind != NodeKind::State;
   }
+  bool operator()(FrozenNetlist const &graph,
+                  FrozenNetlist::EdgeIndex edge) const {
+    return !graph.isDisabled(edge) &&
+           graph.getKind(graph.getSource(edge)) != NodeKind::State;
+  }
 };
 
 class CollectVisitor {
@@ -146,30 +297,344 @@ private:
   std::vector<NetlistNode *> &result;
 };
 
+/// CollectVisitor counterpart for traversals over a FrozenNetlist.
+class FrozenCollectVisitor {
+public:
+  FrozenCollectVisitor(FrozenNetlist const &graph,
+                       std::vector<NetlistNode *> &result)
+      : graph(graph), result(result) {}
+  void visitedNode(FrozenNetlist::NodeIndex) {}
+  void visitNode(FrozenNetlist::NodeIndex node) {
+    result.push_back(&graph.getNode(node));
+  }
+  void visitEdge(FrozenNetlist::EdgeIndex) {}
+  void popNode() {}
+
+private:
+  FrozenNetlist const &graph;
+  std::vector<NetlistNode *> &result;
+};
+
 } // namespace
 
 auto NetlistGraph::getCombFanOut(NetlistNode &node) const
     -> std::vector<NetlistNode *> {
+  TraversalContext context;
+  return getCombFanOut(node, context);
+}
+
+auto NetlistGraph::getCombFanOut(NetlistNode &node,
+                                 TraversalContext &context) const
+    -> std::vector<NetlistNode *> {
   std::vector<NetlistNode *> result;
+  if (auto start = frozenIndex(node); start != FrozenNetlist::null_index) {
+    FrozenCollectVisitor visitor(*frozen, result);
+    IndexedDepthFirstSearch<FrozenNetlist, FrozenCollectVisitor,
+                            CombFanPredicate, Direction::Forward>
+        dfs(context, *frozen, visitor, start);
+    return result;
+  }
   CollectVisitor visitor(result);
   DepthFirstSearch<NetlistNode, NetlistEdge, CollectVisitor, CombFanPredicate,
                    Direction::Forward>
-      dfs(visitor, node);
+      dfs(context, visitor, node);
   return result;
 }
 
 auto NetlistGraph::getCombFanIn(NetlistNode &node) const
     -> std::vector<NetlistNode *> {
+  TraversalContext context;
+  return getCombFanIn(node, context);
+}
+
+auto NetlistGraph::getCombFanIn(NetlistNode &node,
+                                TraversalContext &context) const
+    -> std::vector<NetlistNode *> {
   std::vector<NetlistNode *> result;
+  if (auto start = frozenIndex(node); start != FrozenNetlist::null_index) {
+    FrozenCollectVisitor visitor(*frozen, result);
+    IndexedDepthFirstSearch<FrozenNetlist, FrozenCollectVisitor,
+                            CombFanBackwardPredicate, Direction::Backward>
+        dfs(context, *frozen, visitor, start);
+    return result;
+  }
   CollectVisitor visitor(result);
   DepthFirstSearch<NetlistNode, NetlistEdge, CollectVisitor,
                    CombFanBackwardPredicate, Direction::Backward>
-      dfs(visitor, node);
+      dfs(context, visitor, node);
+  return result;
+}
+
+auto NetlistGraph::getCombFanOut(NetlistNode &node, DriverBitRange bits) const
+    -> std::vector<BitNode> {
+  SLANG_ASSERT(!edgesReleased);
+  return BitTraversal<Direction::Forward, CombFanPredicate>(node, bits)
+      .takeReached();
+}
+
+auto NetlistGraph::getCombFanIn(NetlistNode &node, DriverBitRange bits) const
+    -> std::vector<BitNode> {
+  SLANG_ASSERT(!edgesReleased);
+  return BitTraversal<Direction::Backward, CombFanBackwardPredicate>(node,
+                                                                     bits)
+      .takeReached();
+}
+
+namespace {
+
+/// Sources whose cones one sweep of the batched queries computes. Each node
+/// of the swept subgraph carries a membership bit per source, in words the
+/// compiler can OR together as one vector.
+constexpr size_t conesPerSweep = 256;
+using ConeMask = std::array<uint64_t, conesPerSweep / 64>;
+
+/// The subgraph reachable from a set of sources over combinational edges,
+/// numbered locally in order of discovery and condensed into its strongly
+/// connected components.
+struct ConeGraph {
+  /// The graph index of each local node.
+  std::vector<uint32_t> nodes;
+  /// The local node of each source.
+  std::vector<uint32_t> sources;
+  /// The component of each local node. Every edge between two components
+  /// leads from a higher number to a lower one.
+  std::vector<uint32_t> components;
+  uint32_t numComponents = 0;
+  /// The components that component c has edges to, other than itself, are
+  /// successors[firstSuccessor[c]] up to successors[firstSuccessor[c + 1]].
+  std::vector<uint32_t> firstSuccessor;
+  std::vector<uint32_t> successors;
+};
+
+/// Collect the subgraph reachable from the nodes with graph indices
+/// @p sources, calling @p forEachNext(node, f) to have f called with each
+/// successor of a node, and condense it.
+template <typename ForEachNext>
+auto buildConeGraph(size_t numNodes, std::span<uint32_t const> sources,
+                    ForEachNext const &forEachNext) -> ConeGraph {
+  constexpr auto unseen = std::numeric_limits<uint32_t>::max();
+  ConeGraph cone;
+  std::vector<uint32_t> local(numNodes, unseen);
+  auto discover = [&](uint32_t node) {
+    if (local[node] == unseen) {
+      local[node] = static_cast<uint32_t>(cone.nodes.size());
+      cone.nodes.push_back(node);
+    }
+    return local[node];
+  };
+  for (auto source : sources) {
+    cone.sources.push_back(discover(source));
+  }
+  // Breadth-first, so the nodes discovered so far are those to expand.
+  std::vector<uint32_t> firstEdge{0};
+  std::vector<uint32_t> targets;
+  for (size_t n = 0; n < cone.nodes.size(); n++) {
+    forEachNext(cone.nodes[n],
+                [&](uint32_t next) { targets.push_back(discover(next)); });
+    firstEdge.push_back(static_cast<uint32_t>(targets.size()));
+  }
+
+  // The members of a loop reach each other, so they share one mask, and
+  // the edges between components, deduplicated, form a DAG.
+  StronglyConnectedComponents scc(firstEdge, targets);
+  std::vector<uint32_t> firstMember;
+  std::vector<uint32_t> members;
+  scc.groupMembers(firstMember, members);
+  cone.numComponents = scc.numComponents;
+  cone.components = std::move(scc.components);
+  cone.firstSuccessor.reserve(cone.numComponents + 1);
+  cone.firstSuccessor.push_back(0);
+  for (uint32_t c = 0; c < cone.numComponents; c++) {
+    auto const numBefore = cone.successors.size();
+    for (auto m = firstMember[c]; m < firstMember[c + 1]; m++) {
+      auto n = members[m];
+      for (auto e = firstEdge[n]; e < firstEdge[n + 1]; e++) {
+        if (auto next = cone.components[targets[e]]; next != c) {
+          cone.successors.push_back(next);
+        }
+      }
+    }
+    auto const first = cone.successors.begin() + numBefore;
+    std::sort(first, cone.successors.end());
+    cone.successors.erase(std::unique(first, cone.successors.end()),
+                          cone.successors.end());
+    cone.firstSuccessor.push_back(
+        static_cast<uint32_t>(cone.successors.size()));
+  }
+  return cone;
+}
+
+/// Propagate each mask in @p masks, one per component of @p cone, to the
+/// components it reaches, so that every component carries the bits of all
+/// sources that reach it. Descending component order is topological, so
+/// each mask is complete before it is passed on and one pass suffices.
+void sweepCones(ConeGraph const &cone, std::vector<ConeMask> &masks) {
+  for (auto c = cone.numComponents; c-- > 0;) {
+    auto const &mask = masks[c];
+    for (auto e = cone.firstSuccessor[c]; e < cone.firstSuccessor[c + 1];
+         e++) {
+      auto &next = masks[cone.successors[e]];
+      for (size_t w = 0; w < next.size(); w++) {
+        next[w] |= mask[w];
+      }
+    }
+  }
+}
+
+/// Compute the cones of @p sources together, calling @p emit(i, node) for
+/// each node in the cone of source i, with the nodes of each cone in graph
+/// order. @p forEachNext is as for buildConeGraph.
+template <typename ForEachNext, typename Emit>
+void forEachConeMember(size_t numNodes, std::span<uint32_t const> sources,
+                       ForEachNext const &forEachNext, Emit const &emit) {
+  auto const cone = buildConeGraph(numNodes, sources, forEachNext);
+  std::vector<uint32_t> byGraphOrder(cone.nodes.size());
+  std::iota(byGraphOrder.begin(), byGraphOrder.end(), 0);
+  std::ranges::sort(byGraphOrder, {},
+                    [&](uint32_t n) { return cone.nodes[n]; });
+
+  std::vector<ConeMask> masks(cone.numComponents);
+  for (size_t first = 0; first < sources.size(); first += conesPerSweep) {
+    auto const count = std::min(conesPerSweep, sources.size() - first);
+    std::ranges::fill(masks, ConeMask{});
+    for (size_t i = 0; i < count; i++) {
+      masks[cone.components[cone.sources[first + i]]][i / 64] |=
+          uint64_t{1} << (i % 64);
+    }
+    sweepCones(cone, masks);
+    for (auto n : byGraphOrder) {
+      auto const &mask = masks[cone.components[n]];
+      for (size_t w = 0; w < mask.size(); w++) {
+        for (auto bits = mask[w]; bits != 0; bits &= bits - 1) {
+          auto bit = w * 64 + static_cast<size_t>(std::countr_zero(bits));
+          emit(first + bit, cone.nodes[n]);
+        }
+      }
+    }
+  }
+}
+
+/// Compute the combinational cones of @p sources in direction @p Dir, with
+/// the edge predicates of getCombFanOut and getCombFanIn, over the frozen
+/// snapshot of @p graph if every source is in it.
+template <Direction Dir, typename Emit>
+void forEachCombConeMember(NetlistGraph const &graph,
+                           std::span<NetlistNode *const> sources,
+                           Emit const &emit) {
+  std::vector<uint32_t> starts;
+  starts.reserve(sources.size());
+  auto const *frozen = graph.getFrozen();
+  for (auto *source : sources) {
+    auto index = frozen ? frozen->getIndex(*source) : FrozenNetlist::null_index;
+    if (index == FrozenNetlist::null_index) {
+      frozen = nullptr;
+      break;
+    }
+    starts.push_back(index);
+  }
+
+  if (frozen != nullptr) {
+    auto forEachNext = [&](uint32_t node, auto &&visit) {
+      if constexpr (Dir == Direction::Forward) {
+        for (auto edge : frozen->outEdges(node)) {
+          if (CombFanPredicate{}(*frozen, edge)) {
+            visit(frozen->getTarget(edge));
+          }
+        }
+      } else {
+        for (auto edge : frozen->inEdges(node)) {
+          if (CombFanBackwardPredicate{}(*frozen, edge)) {
+            visit(frozen->getSource(edge));
+          }
+        }
+      }
+    };
+    forEachConeMember(frozen->numNodes(), starts, forEachNext,
+                      [&](size_t source, uint32_t node) {
+                        emit(source, frozen->getNode(node));
+                      });
+    return;
+  }
+
+  starts.clear();
+  for (auto *source : sources) {
+    SLANG_ASSERT(graph.findNode(*source) < graph.numNodes());
+    starts.push_back(static_cast<uint32_t>(source->getGraphIndex()));
+  }
+  auto forEachNext = [&](uint32_t index, auto &&visit) {
+    auto const &node = graph.getNode(index);
+    if constexpr (Dir == Direction::Forward) {
+      for (auto const &edge : node.getOutEdges()) {
+        if (CombFanPredicate{}(*edge)) {
+          visit(static_cast<uint32_t>(edge->getTargetNode().getGraphIndex()));
+        }
+      }
+    } else {
+      for (auto const *edge : node.getInEdges()) {
+        if (CombFanBackwardPredicate{}(*edge)) {
+          visit(static_cast<uint32_t>(edge->getSourceNode().getGraphIndex()));
+        }
+      }
+    }
+  };
+  forEachConeMember(graph.numNodes(), starts, forEachNext,
+                    [&](size_t source, uint32_t node) {
+                      emit(source, graph.getNode(node));
+                    });
+}
+
+} // namespace
+
+auto NetlistGraph::getCombFanOutMany(
+    std::span<NetlistNode *const> sources) const
+    -> std::vector<std::vector<NetlistNode *>> {
+  std::vector<std::vector<NetlistNode *>> result(sources.size());
+  forEachCombConeMember<Direction::Forward>(
+      *this, sources, [&](size_t source, NetlistNode &node) {
+        result[source].push_back(&node);
+      });
+  return result;
+}
+
+auto NetlistGraph::getCombFanInMany(std::span<NetlistNode *const> sources) const
+    -> std::vector<std::vector<NetlistNode *>> {
+  std::vector<std::vector<NetlistNode *>> result(sources.size());
+  forEachCombConeMember<Direction::Backward>(
+      *this, sources, [&](size_t source, NetlistNode &node) {
+        result[source].push_back(&node);
+      });
+  return result;
+}
+
+auto NetlistGraph::getCombFanOutCounts(
+    std::span<NetlistNode *const> sources) const -> std::vector<size_t> {
+  std::vector<size_t> result(sources.size(), 0);
+  forEachCombConeMember<Direction::Forward>(
+      *this, sources, [&](size_t source, NetlistNode &) { result[source]++; });
+  return result;
+}
+
+auto NetlistGraph::getCombFanInCounts(
+    std::span<NetlistNode *const> sources) const -> std::vector<size_t> {
+  std::vector<size_t> result(sources.size(), 0);
+  forEachCombConeMember<Direction::Backward>(
+      *this, sources, [&](size_t source, NetlistNode &) { result[source]++; });
   return result;
 }
 
 auto NetlistGraph::getSensitivity(NetlistNode &node) const
     -> std::vector<SensitivitySource> {
+  TraversalContext context;
+  return getSensitivity(node, context);
+}
+
+auto NetlistGraph::getSensitivity(NetlistNode &node,
+                                  TraversalContext &context) const
+    -> std::vector<SensitivitySource> {
+  if (auto start = frozenIndex(node); start != FrozenNetlist::null_index) {
+    return getFrozenSensitivity(start, context);
+  }
+
   std::vector<SensitivitySource> result;
 
   auto collectFromState = [&](NetlistNode &state) {
@@ -197,9 +662,9 @@ auto NetlistGraph::getSensitivity(NetlistNode &node) const
 
   // Forward walk: collect State targets without traversing into them.
   // getCombFanOut can't be reused — its predicate drops edges-to-State.
-  std::unordered_set<NetlistNode *> visited;
   std::vector<NetlistNode *> stack;
-  visited.insert(&node);
+  context.reset(numNodes());
+  context.markVisited(node.getGraphIndex());
   stack.push_back(&node);
   while (!stack.empty()) {
     auto *cur = stack.back();
@@ -213,7 +678,7 @@ auto NetlistGraph::getSensitivity(NetlistNode &node) const
         collectFromState(target);
         continue;
       }
-      if (visited.insert(&target).second) {
+      if (context.markVisited(target.getGraphIndex())) {
         stack.push_back(&target);
       }
     }
@@ -221,11 +686,99 @@ auto NetlistGraph::getSensitivity(NetlistNode &node) const
   return result;
 }
 
+auto NetlistGraph::getFrozenSensitivity(FrozenNetlist::NodeIndex start,
+                                        TraversalContext &context) const
+    -> std::vector<SensitivitySource> {
+  using NodeIndex = FrozenNetlist::NodeIndex;
+  std::vector<SensitivitySource> result;
+
+  auto collectFromState = [&](NodeIndex state) {
+    SLANG_ASSERT(frozen->getKind(state) == NodeKind::State);
+    for (auto edge : frozen->inEdges(state)) {
+      auto edgeKind = frozen->getEdgeKind(edge);
+      if (frozen->isDisabled(edge) || edgeKind == ast::EdgeKind::None) {
+        continue;
+      }
+      auto *source = &frozen->getNode(frozen->getSource(edge));
+      auto duplicate =
+          std::any_of(result.begin(), result.end(), [&](auto const &existing) {
+            return existing.source == source && existing.edgeKind == edgeKind;
+          });
+      if (!duplicate) {
+        result.push_back({source, edgeKind});
+      }
+    }
+  };
+
+  if (frozen->getKind(start) == NodeKind::State) {
+    collectFromState(start);
+    return result;
+  }
+
+  std::vector<NodeIndex> stack;
+  context.reset(frozen->numNodes());
+  context.markVisited(start);
+  stack.push_back(start);
+  while (!stack.empty()) {
+    auto cur = stack.back();
+    stack.pop_back();
+    for (auto edge : frozen->outEdges(cur)) {
+      if (frozen->isDisabled(edge)) {
+        continue;
+      }
+      auto target = frozen->getTarget(edge);
+      if (frozen->getKind(target) == NodeKind::State) {
+        collectFromState(target);
+        continue;
+      }
+      if (context.markVisited(target)) {
+        stack.push_back(target);
+      }
+    }
+  }
+  return result;
+}
+
 auto NetlistGraph::getConstantDrivers(NetlistNode &node) const
     -> std::vector<NetlistNode *> {
-  auto fanIn = getCombFanIn(node);
+  TraversalContext context;
+  return getConstantDrivers(node, context);
+}
+
+auto NetlistGraph::getConstantDrivers(NetlistNode &node,
+                                      TraversalContext &context) const
+    -> std::vector<NetlistNode *> {
+  auto fanIn = getCombFanIn(node, context);
+
+  // On a frozen graph the in-edges are read from the snapshot, which still
+  // has them when the pointer-based edges have been released.
+  auto const *snapshot =
+      frozenIndex(node) != FrozenNetlist::null_index ? frozen.get() : nullptr;
+  auto isFedByState = [&](NetlistNode const &n) {
+    if (snapshot != nullptr) {
+      return std::ranges::any_of(
+          snapshot->inEdges(snapshot->getIndex(n)), [&](auto edge) {
+            return !snapshot->isDisabled(edge) &&
+                   snapshot->getKind(snapshot->getSource(edge)) ==
+                       NodeKind::State;
+          });
+    }
+    return std::ranges::any_of(n.getInEdges(), [](auto *edge) {
+      return !edge->disabled && edge->getSourceNode().kind == NodeKind::State;
+    });
+  };
+  auto isDriven = [&](NetlistNode const &n) {
+    return snapshot != nullptr ? snapshot->inDegree(snapshot->getIndex(n)) > 0
+                               : n.as<Port>().isDriven();
+  };
+
   std::vector<NetlistNode *> constants;
   for (auto *n : fanIn) {
+    // The fan-in stops at State nodes, so a register feeding it shows up as
+    // an edge into one of its members: not constant-driven.
+    if (isFedByState(*n)) {
+      return {};
+    }
     if (n == &node) {
       continue;
     }
@@ -233,13 +786,10 @@ auto NetlistGraph::getConstantDrivers(NetlistNode &node) const
     case NodeKind::Constant:
       constants.push_back(n);
       break;
-    case NodeKind::State:
-      // Depends on a register: not constant-driven.
-      return {};
     case NodeKind::Port:
       // An undriven Port in the fan-in is a top-level input acting as
       // a real external source. A driven Port is just a pass-through.
-      if (!n->as<Port>().isDriven()) {
+      if (!isDriven(*n)) {
         return {};
       }
       break;
@@ -255,27 +805,228 @@ auto NetlistGraph::getConstantDrivers(NetlistNode &node) const
   return constants;
 }
 
+namespace {
+
+/// True if @p edge carries a symbol annotation or a clock edge kind.
+auto isAnnotated(NetlistEdge const &edge) -> bool {
+  return edge.symbol != nullptr || edge.edgeKind != slang::ast::EdgeKind::None;
+}
+
+/// True if @p node is of a kind that contractPassThroughNodes() removes.
+auto isPassThroughKind(NetlistNode const &node) -> bool {
+  switch (node.kind) {
+  case NodeKind::Assignment:
+  case NodeKind::Merge:
+    return true;
+  case NodeKind::Conditional:
+    return node.inDegree() == 1;
+  default:
+    return false;
+  }
+}
+
+/// Return true if @p node can be contracted without losing an edge
+/// annotation or increasing the number of edges.
+auto isContractible(NetlistNode const &node) -> bool {
+  auto const &inEdges = node.getInEdges();
+  auto const &outEdges = node.getOutEdges();
+  if (!isPassThroughKind(node) || inEdges.empty() || outEdges.empty()) {
+    return false;
+  }
+  size_t annotatedIn = 0;
+  for (auto const *edge : inEdges) {
+    // A clock-sensitive input only makes sense on the node itself.
+    if (edge->disabled || edge->edgeKind != slang::ast::EdgeKind::None ||
+        &edge->getSourceNode() == &node) {
+      return false;
+    }
+    annotatedIn += edge->symbol != nullptr ? 1 : 0;
+  }
+  size_t annotatedOut = 0;
+  for (auto const &edge : outEdges) {
+    if (edge->disabled) {
+      return false;
+    }
+    annotatedOut += isAnnotated(*edge) ? 1 : 0;
+  }
+  // Each (in, out) pair is replaced by one edge, or by two when both
+  // edges carry an annotation.
+  auto replacements =
+      inEdges.size() * outEdges.size() + annotatedIn * annotatedOut;
+  return replacements <= inEdges.size() + outEdges.size();
+}
+
+/// Add an edge from @p source to @p target with the annotation of
+/// @p annotation, or a plain edge if it is null, unless an equivalent edge
+/// already exists.
+void addContractedEdge(NetlistNode &source, NetlistNode &target,
+                       NetlistEdge const *annotation) {
+  if (source.lookupOutEdge(target) != nullptr) {
+    for (auto const &edge : source.getOutEdges()) {
+      if (&edge->getTargetNode() != &target || edge->disabled) {
+        continue;
+      }
+      // Any combinational edge subsumes a plain one.
+      if (annotation == nullptr ? edge->edgeKind == slang::ast::EdgeKind::None
+                                : edge->symbol == annotation->symbol &&
+                                      edge->bounds == annotation->bounds &&
+                                      edge->edgeKind == annotation->edgeKind) {
+        return;
+      }
+    }
+  }
+  auto &edge = source.addNewEdge(target);
+  if (annotation != nullptr) {
+    edge.setVariable(annotation->symbol, annotation->bounds);
+    edge.setEdgeKind(annotation->edgeKind);
+  }
+}
+
+} // namespace
+
+auto NetlistGraph::contractPassThroughNodes() -> size_t {
+  unfreeze();
+  std::vector<NetlistNode *> contracted;
+  for (auto const &nodePtr : nodes) {
+    auto &node = *nodePtr;
+    if (!isContractible(node)) {
+      continue;
+    }
+    for (auto const *inEdge : node.getInEdges()) {
+      auto &source = inEdge->getSourceNode();
+      for (auto const &outEdge : node.getOutEdges()) {
+        auto &target = outEdge->getTargetNode();
+        bool annotatedOut = isAnnotated(*outEdge);
+        if (annotatedOut) {
+          addContractedEdge(source, target, outEdge.get());
+        }
+        if (inEdge->symbol != nullptr) {
+          addContractedEdge(source, target, inEdge);
+        }
+        if (!annotatedOut && inEdge->symbol == nullptr) {
+          addContractedEdge(source, target, nullptr);
+        }
+      }
+    }
+    // Detach the node now so that later contractions see the new edges.
+    node.clearAllEdges();
+    contracted.push_back(&node);
+  }
+  return removeNodes(contracted);
+}
+
 auto NetlistGraph::findNodes(std::string_view pattern) const
     -> std::vector<NetlistNode *> {
-  buildIndex();
-  std::string pat(pattern);
-  std::vector<NetlistNode *> result;
-  for (auto const &[name, nodeList] : nodeIndex) {
-    if (wildcardMatch(name.c_str(), pat.c_str())) {
-      result.insert(result.end(), nodeList.begin(), nodeList.end());
+  return getHierarchyTrie().match(pattern);
+}
+
+auto NetlistGraph::findNodesInScope(std::string_view scope) const
+    -> std::vector<NetlistNode *> {
+  return getHierarchyTrie().inScope(scope);
+}
+
+namespace {
+
+/// Paths fewer than this are matched on the calling thread.
+constexpr size_t regexParallelThreshold = size_t{1} << 12;
+
+/// Return a literal string that every full match of the ECMAScript regex
+/// @p pattern must begin with, or an empty string if none can be found
+/// cheaply. Reading stops at the first construct that is not a literal
+/// character or an escaped punctuation character, and a character
+/// followed by a quantifier is dropped.
+auto requiredPrefix(std::string_view pattern) -> std::string {
+  // An alternation at the top level can match without the prefix.
+  int depth = 0;
+  bool inClass = false;
+  for (size_t i = 0; i < pattern.size(); i++) {
+    auto ch = pattern[i];
+    if (ch == '\\') {
+      i++;
+    } else if (inClass) {
+      inClass = ch != ']';
+    } else if (ch == '[') {
+      inClass = true;
+    } else if (ch == '(') {
+      depth++;
+    } else if (ch == ')') {
+      depth--;
+    } else if (ch == '|' && depth == 0) {
+      return {};
     }
   }
-  return result;
+
+  std::string prefix;
+  size_t pos = pattern.starts_with('^') ? 1 : 0;
+  while (pos < pattern.size()) {
+    auto ch = pattern[pos];
+    size_t length = 1;
+    if (ch == '\\') {
+      if (pos + 1 == pattern.size() ||
+          std::isalnum(static_cast<unsigned char>(pattern[pos + 1]))) {
+        break;
+      }
+      ch = pattern[pos + 1];
+      length = 2;
+    } else if (std::string_view(".[](){}*+?|^$").find(ch) !=
+               std::string_view::npos) {
+      break;
+    }
+    auto next = pos + length;
+    auto const quantifiers = std::string_view("*+?{");
+    if (next < pattern.size() &&
+        quantifiers.find(pattern[next]) != std::string_view::npos) {
+      break;
+    }
+    prefix.push_back(ch);
+    pos = next;
+  }
+  return prefix;
 }
 
-auto NetlistGraph::findNodesRegex(std::string_view pattern) const
+} // namespace
+
+auto NetlistGraph::findNodesRegex(std::string_view pattern,
+                                  bool parallel) const
     -> std::vector<NetlistNode *> {
-  buildIndex();
-  std::regex re(pattern.begin(), pattern.end());
+  // Compile on the calling thread so that a malformed pattern throws here.
+  std::regex const re(pattern.begin(), pattern.end());
+  auto candidates = getHierarchyTrie().withPrefix(requiredPrefix(pattern));
+
+  // Match blocks of candidates in parallel, each with its own regex, and
+  // record the matches by candidate so that the result is assembled in
+  // candidate order whatever the number of threads.
+  std::vector<uint8_t> matched(candidates.size(), 0);
+  auto matchBlock = [&](std::regex const &blockRe, size_t first,
+                        size_t last) {
+    std::string path;
+    for (auto i = first; i < last; i++) {
+      path.clear();
+      candidates[i].symbol->appendHierarchicalPath(path);
+      matched[i] = std::regex_match(path, blockRe);
+    }
+  };
+  if (!parallel || candidates.size() < regexParallelThreshold ||
+      buildProfile.numThreads == 1) {
+    matchBlock(re, 0, candidates.size());
+  } else {
+    auto &pool = getQueryPool();
+    auto const numBlocks = pool.getThreadCount();
+    auto const blockSize = (candidates.size() + numBlocks - 1) / numBlocks;
+    auto matchNthBlock = [&](size_t block) {
+      std::regex const blockRe(pattern.begin(), pattern.end());
+      auto first = std::min(candidates.size(), block * blockSize);
+      auto last = std::min(candidates.size(), first + blockSize);
+      matchBlock(blockRe, first, last);
+    };
+    pool.forEach(numBlocks, matchNthBlock);
+  }
+
   std::vector<NetlistNode *> result;
-  for (auto const &[name, nodeList] : nodeIndex) {
-    if (std::regex_match(name, re)) {
-      result.insert(result.end(), nodeList.begin(), nodeList.end());
+  for (size_t i = 0; i < candidates.size(); i++) {
+    if (matched[i] != 0) {
+      result.insert(result.end(), candidates[i].nodes.begin(),
+                    candidates[i].nodes.end());
     }
   }
   return result;
@@ -283,6 +1034,8 @@ auto NetlistGraph::findNodesRegex(std::string_view pattern) const
 
 auto NetlistGraph::getBlackBoxCoverage(NetlistNode const &node) const
     -> BlackBoxCoverage {
+  // A single node's path is read from the node rather than the node table,
+  // which would take the table lock on every call.
   auto path = node.getHierarchicalPath();
   if (!path) {
     return BlackBoxCoverage::Outside;
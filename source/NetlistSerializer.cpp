@@ -139,14 +139,16 @@ static auto locationFromJson(json const &j) -> TextLocation {
 static auto symbolToJson(SymbolReference const &sym) -> json {
   json j;
   j["name"] = sym.name;
-  j["path"] = sym.hierarchicalPath;
+  j["path"] = sym.getHierarchicalPath();
   j["location"] = locationToJson(sym.location);
   return j;
 }
 
-static auto symbolFromJson(json const &j) -> SymbolReference {
-  return {j.at("name").get<std::string>(), j.at("path").get<std::string>(),
-          locationFromJson(j.at("location"))};
+static auto symbolFromJson(json const &j, SymbolTable &symbolTable)
+    -> SymbolReference const * {
+  return symbolTable.intern(j.at("name").get<std::string>(),
+                            j.at("path").get<std::string>(),
+                            locationFromJson(j.at("location")));
 }
 
 //===----------------------------------------------------------------------===//
@@ -154,6 +156,7 @@ static auto symbolFromJson(json const &j) -> SymbolReference {
 //===----------------------------------------------------------------------===//
 
 auto NetlistSerializer::serialize(NetlistGraph const &graph) -> std::string {
+  SLANG_ASSERT(!graph.hasReleasedEdges());
   json root;
   root["version"] = formatVersion;
 
@@ -172,65 +175,31 @@ auto NetlistSerializer::serialize(NetlistGraph const &graph) -> std::string {
   }
   root["blackBoxes"] = blackBoxesJson;
 
-  // Serialize nodes.
+  // Serialize nodes, reading the attributes from the node table's columns.
   json nodesJson = json::array();
-  for (auto const &nodePtr : graph) {
-    auto const &node = *nodePtr;
+  auto const &table = graph.getNodeTable();
+  for (size_t i = 0; i < table.size(); ++i) {
+    auto kind = table.getKind(i);
     json nodeJson;
-    nodeJson["id"] = node.ID;
-    nodeJson["kind"] = nodeKindToString(node.kind);
-
-    switch (node.kind) {
-    case NodeKind::Port: {
-      auto const &port = node.as<Port>();
-      nodeJson["path"] = port.hierarchicalPath;
-      nodeJson["name"] = port.name;
-      nodeJson["bounds"] = {port.bounds.lower(), port.bounds.upper()};
-      nodeJson["direction"] = directionToString(port.direction);
-      nodeJson["location"] = locationToJson(port.location);
-      break;
+    nodeJson["id"] = table.getID(i);
+    nodeJson["kind"] = nodeKindToString(kind);
+
+    if (auto const *symbol = table.getSymbol(i)) {
+      auto bounds = table.getBounds(i);
+      nodeJson["path"] = symbol->getHierarchicalPath();
+      nodeJson["name"] = symbol->name;
+      nodeJson["bounds"] = {bounds.lower(), bounds.upper()};
     }
-    case NodeKind::Variable: {
-      auto const &var = node.as<Variable>();
-      nodeJson["path"] = var.hierarchicalPath;
-      nodeJson["name"] = var.name;
-      nodeJson["bounds"] = {var.bounds.lower(), var.bounds.upper()};
-      nodeJson["location"] = locationToJson(var.location);
-      break;
+    if (kind != NodeKind::Merge && kind != NodeKind::None) {
+      nodeJson["location"] = locationToJson(table.getLocation(i));
     }
-    case NodeKind::State: {
-      auto const &state = node.as<State>();
-      nodeJson["path"] = state.hierarchicalPath;
-      nodeJson["name"] = state.name;
-      nodeJson["bounds"] = {state.bounds.lower(), state.bounds.upper()};
-      nodeJson["location"] = locationToJson(state.location);
-      break;
-    }
-    case NodeKind::Assignment: {
-      auto const &assign = node.as<Assignment>();
-      nodeJson["location"] = locationToJson(assign.location);
-      break;
-    }
-    case NodeKind::Conditional: {
-      auto const &cond = node.as<Conditional>();
-      nodeJson["location"] = locationToJson(cond.location);
-      break;
-    }
-    case NodeKind::Case: {
-      auto const &caseNode = node.as<Case>();
-      nodeJson["location"] = locationToJson(caseNode.location);
-      break;
-    }
-    case NodeKind::Constant: {
-      auto const &constNode = node.as<Constant>();
-      nodeJson["location"] = locationToJson(constNode.location);
+    if (kind == NodeKind::Port) {
+      nodeJson["direction"] =
+          directionToString(table.getNode(i).as<Port>().direction);
+    } else if (kind == NodeKind::Constant) {
+      auto const &constNode = table.getNode(i).as<Constant>();
       nodeJson["width"] = constNode.width;
       nodeJson["value"] = constNode.value.toString();
-      break;
-    }
-    case NodeKind::Merge:
-    case NodeKind::None:
-      break;
     }
 
     nodesJson.push_back(std::move(nodeJson));
@@ -291,55 +260,50 @@ void NetlistSerializer::deserialize(std::string_view jsonStr,
     auto id = nodeJson.at("id").get<size_t>();
     auto kind = nodeKindFromString(nodeJson.at("kind").get<std::string>());
 
-    std::unique_ptr<NetlistNode> node;
+    NetlistNode *node = nullptr;
 
     switch (kind) {
     case NodeKind::Port: {
       auto boundsArr = nodeJson.at("bounds");
-      auto portNode = std::make_unique<Port>(
-          nodeJson.at("name").get<std::string>(),
-          nodeJson.at("path").get<std::string>(),
+      node = &graph.emplaceNode<Port>(
+          symbolFromJson(nodeJson, graph.symbolTable),
           locationFromJson(nodeJson.at("location")),
           directionFromString(nodeJson.at("direction").get<std::string>()),
           DriverBitRange{boundsArr[0].get<int32_t>(),
                          boundsArr[1].get<int32_t>()});
-      node = std::move(portNode);
       break;
     }
     case NodeKind::Variable: {
       auto boundsArr = nodeJson.at("bounds");
-      auto varNode = std::make_unique<Variable>(
-          nodeJson.at("name").get<std::string>(),
-          nodeJson.at("path").get<std::string>(),
+      node = &graph.emplaceNode<Variable>(
+          symbolFromJson(nodeJson, graph.symbolTable),
           locationFromJson(nodeJson.at("location")),
           DriverBitRange{boundsArr[0].get<int32_t>(),
                          boundsArr[1].get<int32_t>()});
-      node = std::move(varNode);
       break;
     }
     case NodeKind::State: {
       auto boundsArr = nodeJson.at("bounds");
-      auto stateNode =
-          std::make_unique<State>(nodeJson.at("name").get<std::string>(),
-                                  nodeJson.at("path").get<std::string>(),
-                                  locationFromJson(nodeJson.at("location")),
-                                  DriverBitRange{boundsArr[0].get<int32_t>(),
-                                                 boundsArr[1].get<int32_t>()});
-      node = std::move(stateNode);
+      node = &graph.emplaceNode<State>(
+          symbolFromJson(nodeJson, graph.symbolTable),
+          locationFromJson(nodeJson.at("location")),
+          DriverBitRange{boundsArr[0].get<int32_t>(),
+                         boundsArr[1].get<int32_t>()});
       break;
     }
     case NodeKind::Assignment: {
-      node = std::make_unique<Assignment>(
+      node = &graph.emplaceNode<Assignment>(
           locationFromJson(nodeJson.at("location")));
       break;
     }
     case NodeKind::Conditional: {
-      node = std::make_unique<Conditional>(
+      node = &graph.emplaceNode<Conditional>(
           locationFromJson(nodeJson.at("location")));
       break;
     }
     case NodeKind::Case: {
-      node = std::make_unique<Case>(locationFromJson(nodeJson.at("location")));
+      node =
+          &graph.emplaceNode<Case>(locationFromJson(nodeJson.at("location")));
       break;
     }
     case NodeKind::Constant: {
@@ -357,22 +321,21 @@ void NetlistSerializer::deserialize(std::string_view jsonStr,
           value = ConstantValue();
         }
       }
-      node = std::make_unique<Constant>(
+      node = &graph.emplaceNode<Constant>(
           std::move(value), width, locationFromJson(nodeJson.at("location")));
       break;
     }
     case NodeKind::Merge: {
-      node = std::make_unique<Merge>();
+      node = &graph.emplaceNode<Merge>();
       break;
     }
     case NodeKind::None: {
-      node = std::make_unique<NetlistNode>(NodeKind::None);
+      node = &graph.emplaceNode<NetlistNode>(NodeKind::None);
       break;
     }
     }
 
-    auto &addedNode = graph.addNode(std::move(node));
-    idMap[id] = &addedNode;
+    idMap[id] = node;
   }
 
   // Deserialize edges.
@@ -391,8 +354,7 @@ void NetlistSerializer::deserialize(std::string_view jsonStr,
         edgeKindFromString(edgeJson.at("edgeKind").get<std::string>());
     auto const &symJson = edgeJson.at("symbol");
     if (symJson.contains("name")) {
-      auto sym = symbolFromJson(symJson);
-      edge.symbol = graph.symbolTable.intern(sym);
+      edge.symbol = symbolFromJson(symJson, graph.symbolTable);
     } else {
       edge.symbol = nullptr;
     }
@@ -7,28 +7,25 @@ namespace slang::netlist {
 
 auto NodeFactory::createAssignment(ast::AssignmentExpression const &expr)
     -> NetlistNode & {
-  auto node = std::make_unique<Assignment>(
+  return builder.graph.emplaceNode<Assignment>(
       builder.toTextLocation(expr.sourceRange.start()));
-  return builder.graph.addNode(std::move(node));
 }
 
 auto NodeFactory::createConditional(ast::ConditionalStatement const &stmt)
     -> NetlistNode & {
-  auto node = std::make_unique<Conditional>(
+  return builder.graph.emplaceNode<Conditional>(
       builder.toTextLocation(stmt.sourceRange.start()));
-  return builder.graph.addNode(std::move(node));
 }
 
 auto NodeFactory::createCase(ast::CaseStatement const &stmt) -> NetlistNode & {
-  auto node =
-      std::make_unique<Case>(builder.toTextLocation(stmt.sourceRange.start()));
-  return builder.graph.addNode(std::move(node));
+  return builder.graph.emplaceNode<Case>(
+      builder.toTextLocation(stmt.sourceRange.start()));
 }
 
 auto NodeFactory::createConstant(ConstantValue value, uint64_t width,
                                  TextLocation location) -> NetlistNode & {
-  auto node = std::make_unique<Constant>(std::move(value), width, location);
-  return builder.graph.addNode(std::move(node));
+  return builder.graph.emplaceNode<Constant>(std::move(value), width,
+                                            location);
 }
 
 auto NodeFactory::createConstantForSegment(BitSliceSource const &src,
@@ -57,9 +54,8 @@ auto NodeFactory::createPort(ast::PortSymbol const &symbol,
                              DriverBitRange bounds) -> NetlistNode & {
   SLANG_ASSERT(symbol.internalSymbol != nullptr);
   auto const *ref = builder.toSymbolRef(*symbol.internalSymbol);
-  auto &node = builder.graph.addNode(
-      std::make_unique<Port>(ref->name, ref->hierarchicalPath, ref->location,
-                             symbol.direction, bounds));
+  auto &node = builder.graph.emplaceNode<Port>(ref, ref->location,
+                                               symbol.direction, bounds);
   builder.variables.insert(symbol, bounds, node);
   return node;
 }
@@ -67,8 +63,8 @@ auto NodeFactory::createPort(ast::PortSymbol const &symbol,
 auto NodeFactory::createVariable(ast::VariableSymbol const &symbol,
                                  DriverBitRange bounds) -> NetlistNode & {
   auto const *ref = builder.toSymbolRef(symbol);
-  auto &node = builder.graph.addNode(std::make_unique<Variable>(
-      ref->name, ref->hierarchicalPath, ref->location, bounds));
+  auto &node =
+      builder.graph.emplaceNode<Variable>(ref, ref->location, bounds);
   builder.variables.insert(symbol, bounds, node);
   return node;
 }
@@ -76,9 +72,8 @@ auto NodeFactory::createVariable(ast::VariableSymbol const &symbol,
 auto NodeFactory::createState(ast::ValueSymbol const &symbol,
                               DriverBitRange bounds) -> NetlistNode & {
   auto const *symRef = builder.toSymbolRef(symbol);
-  auto node = std::make_unique<State>(symRef->name, symRef->hierarchicalPath,
-                                      symRef->location, bounds);
-  auto &ref = builder.graph.addNode(std::move(node));
+  auto &ref =
+      builder.graph.emplaceNode<State>(symRef, symRef->location, bounds);
   builder.variables.insert(symbol, bounds, ref);
   return ref;
 }
@@ -0,0 +1,74 @@
+#include "netlist/NodeTable.hpp"
+
+using namespace slang::netlist;
+
+NodeTable::NodeTable(DirectedGraph<NetlistNode, NetlistEdge> const &graph)
+    : version(graph.getNodeListVersion()) {
+  auto const numNodes = graph.numNodes();
+  nodes.reserve(numNodes);
+  ids.reserve(numNodes);
+  kinds.reserve(numNodes);
+  bounds.resize(numNodes);
+  locations.resize(numNodes);
+  symbols.resize(numNodes, nullptr);
+
+  for (auto const &nodePtr : graph) {
+    auto &node = *nodePtr;
+    auto const index = nodes.size();
+    SLANG_ASSERT(node.getGraphIndex() == index);
+    nodes.push_back(&node);
+    ids.push_back(node.ID);
+    kinds.push_back(node.kind);
+
+    // Read the attributes through the concrete node types so that building
+    // the table makes no virtual calls either.
+    switch (node.kind) {
+    case NodeKind::Port: {
+      auto const &port = node.as<Port>();
+      symbols[index] = port.symbol;
+      bounds[index] = port.bounds;
+      locations[index] = port.location;
+      break;
+    }
+    case NodeKind::Variable: {
+      auto const &var = node.as<Variable>();
+      symbols[index] = var.symbol;
+      bounds[index] = var.bounds;
+      locations[index] = var.location;
+      break;
+    }
+    case NodeKind::State: {
+      auto const &state = node.as<State>();
+      symbols[index] = state.symbol;
+      bounds[index] = state.bounds;
+      locations[index] = state.location;
+      break;
+    }
+    case NodeKind::Assignment:
+      locations[index] = node.as<Assignment>().location;
+      break;
+    case NodeKind::Conditional:
+      locations[index] = node.as<Conditional>().location;
+      break;
+    case NodeKind::Case:
+      locations[index] = node.as<Case>().location;
+      break;
+    case NodeKind::Constant:
+      locations[index] = node.as<Constant>().location;
+      break;
+    case NodeKind::Merge:
+    case NodeKind::None:
+      break;
+    }
+  }
+}
+
+auto NodeTable::filter(NodeKind kind) const -> std::vector<NetlistNode *> {
+  std::vector<NetlistNode *> result;
+  for (size_t i = 0; i < kinds.size(); i++) {
+    if (kinds[i] == kind) {
+      result.push_back(nodes[i]);
+    }
+  }
+  return result;
+}
@@ -0,0 +1,144 @@
+#include "netlist/PathEnumerator.hpp"
+
+#include <algorithm>
+#include <utility>
+
+using namespace slang::netlist;
+
+namespace {
+
+/// The search checks the clock once every this many steps.
+constexpr uint32_t timeCheckInterval = 256;
+
+/// Set the entry of @p index in @p table, growing the table as needed.
+template <typename T>
+void setEntry(std::vector<T> &table, size_t index, T value) {
+  if (index >= table.size()) {
+    table.resize(std::max(index + 1, table.size() * 2));
+  }
+  table[index] = value;
+}
+
+} // namespace
+
+PathEnumerator::PathEnumerator(NetlistNode &startNode, NetlistNode &endNode,
+                               PathLimits limits, bool combinational)
+    : endNode(endNode), limits(limits), combinational(combinational),
+      deadline(std::chrono::steady_clock::now() + limits.timeLimit) {
+
+  // Find the distance to the end of every node that reaches it within the
+  // depth limit, searching backward one level at a time.
+  reachesEnd.reset();
+  reachesEnd.markVisited(endNode.getGraphIndex());
+  setEntry(distances, endNode.getGraphIndex(), uint32_t{0});
+  std::vector<NetlistNode *> level{&endNode};
+  std::vector<NetlistNode *> nextLevel;
+  for (uint32_t distance = 1;
+       !level.empty() && (limits.maxDepth == 0 || distance <= limits.maxDepth);
+       distance++) {
+    nextLevel.clear();
+    for (auto *node : level) {
+      if (++steps % timeCheckInterval == 0 && timedOut()) {
+        status = Status::TimeLimit;
+        return;
+      }
+      for (auto *edge : node->getInEdges()) {
+        auto &source = edge->getSourceNode();
+        if (follows(*edge) && reachesEnd.markVisited(source.getGraphIndex())) {
+          setEntry(distances, source.getGraphIndex(), distance);
+          nextLevel.push_back(&source);
+        }
+      }
+    }
+    std::swap(level, nextLevel);
+  }
+
+  if (&startNode == &endNode ||
+      !reachesEnd.isVisited(startNode.getGraphIndex())) {
+    status = Status::Exhausted;
+    return;
+  }
+  push(startNode);
+}
+
+auto PathEnumerator::follows(NetlistEdge const &edge) const -> bool {
+  return !edge.disabled &&
+         (!combinational || edge.getTargetNode().kind != NodeKind::State);
+}
+
+void PathEnumerator::push(NetlistNode &node) {
+  setEntry(onPath, node.getGraphIndex(), uint8_t{1});
+
+  // The successors that can still complete a path within the depth limit
+  // without revisiting a node, each once however many edges lead to it.
+  auto const depth = stack.size() + 1;
+  auto const first = static_cast<uint32_t>(candidates.size());
+  for (auto const &edge : node.getOutEdges()) {
+    auto &target = edge->getTargetNode();
+    auto const index = target.getGraphIndex();
+    if (follows(*edge) && reachesEnd.isVisited(index) &&
+        (index >= onPath.size() || onPath[index] == 0) &&
+        (limits.maxDepth == 0 || depth + distances[index] <= limits.maxDepth)) {
+      candidates.push_back(&target);
+    }
+  }
+  auto const begin = candidates.begin() + first;
+  std::ranges::sort(begin, candidates.end(), [&](auto *a, auto *b) {
+    auto const ia = a->getGraphIndex();
+    auto const ib = b->getGraphIndex();
+    return distances[ia] != distances[ib] ? distances[ia] < distances[ib]
+                                          : ia < ib;
+  });
+  candidates.erase(std::unique(begin, candidates.end()), candidates.end());
+  stack.push_back({&node, first, first,
+                   static_cast<uint32_t>(candidates.size())});
+}
+
+void PathEnumerator::pop() {
+  auto const &frame = stack.back();
+  onPath[frame.node->getGraphIndex()] = 0;
+  candidates.resize(frame.first);
+  stack.pop_back();
+}
+
+auto PathEnumerator::timedOut() const -> bool {
+  return limits.timeLimit.count() != 0 &&
+         std::chrono::steady_clock::now() >= deadline;
+}
+
+auto PathEnumerator::next() -> std::optional<NetlistPath> {
+  if (status != Status::Running) {
+    return std::nullopt;
+  }
+  if (timedOut()) {
+    status = Status::TimeLimit;
+    return std::nullopt;
+  }
+  while (!stack.empty()) {
+    if (++steps % timeCheckInterval == 0 && timedOut()) {
+      status = Status::TimeLimit;
+      return std::nullopt;
+    }
+    auto &frame = stack.back();
+    if (frame.next == frame.last) {
+      pop();
+      continue;
+    }
+    auto *node = candidates[frame.next++];
+    if (node != &endNode) {
+      push(*node);
+      continue;
+    }
+    NetlistPath path;
+    for (auto const &entry : stack) {
+      path.add(entry.node);
+    }
+    path.add(endNode);
+    if (++pathCount == limits.maxPaths) {
+      status = Status::PathLimit;
+    }
+    return path;
+  }
+  status = Status::Exhausted;
+  return std::nullopt;
+}
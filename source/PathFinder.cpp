@@ -1,35 +1,42 @@
 #include "netlist/PathFinder.hpp"
 
+#include "BitTraversal.hpp"
 #include "DepthFirstSearch.hpp"
 
 #include "slang/util/Util.h"
 
-#include <map>
+#include <algorithm>
+#include <utility>
 
 namespace slang::netlist {
 
 namespace {
 
-using TraversalMap = std::map<NetlistNode *, NetlistNode *>;
+/// Set the entry of @p node in a table indexed by graph index, growing the
+/// table as needed.
+void setEntry(std::vector<NetlistNode *> &table, NetlistNode const &node,
+              NetlistNode *value) {
+  auto const index = node.getGraphIndex();
+  if (index >= table.size()) {
+    table.resize(std::max(index + 1, table.size() * 2));
+  }
+  table[index] = value;
+}
 
-/// Builds the parent map during DFS so the path can be reconstructed
-/// from the end node back to the start.
+/// Records the parent of each node during DFS so the path can be
+/// reconstructed from the end node back to the start.
 class Visitor {
 public:
-  Visitor(TraversalMap &traversalMap) : traversalMap(traversalMap) {}
+  Visitor(std::vector<NetlistNode *> &parents) : parents(parents) {}
   void visitedNode(NetlistNode &) {}
   void visitNode(NetlistNode &) {}
   void visitEdge(NetlistEdge &edge) {
-    auto *sourceNode = &edge.getSourceNode();
-    auto *targetNode = &edge.getTargetNode();
-    SLANG_ASSERT(traversalMap.count(targetNode) == 0 &&
-                 "node cannot have two parents");
-    traversalMap[targetNode] = sourceNode;
+    setEntry(parents, edge.getTargetNode(), &edge.getSourceNode());
   }
   void popNode() {}
 
 private:
-  TraversalMap &traversalMap;
+  std::vector<NetlistNode *> &parents;
 };
 
 struct EdgePredicate {
@@ -46,19 +53,34 @@ struct CombEdgePredicate {
   }
 };
 
-NetlistPath buildPath(TraversalMap &traversalMap, NetlistNode &startNode,
-                      NetlistNode &endNode) {
-  if (!traversalMap.contains(&endNode)) {
+/// Return a path from @p bits of @p startNode to @p endNode through the
+/// steps of a bit-precise traversal.
+template <class EdgePredicate>
+auto searchBits(NetlistNode &startNode, DriverBitRange bits,
+                NetlistNode &endNode) -> NetlistPath {
+  if (&startNode == &endNode) {
     return {};
   }
-  if (startNode == endNode) {
-    return NetlistPath({&endNode});
+  BitTraversal<Direction::Forward, EdgePredicate> traversal(startNode, bits,
+                                                            &endNode);
+  if (traversal.stopStep == traversal.none) {
+    return {};
+  }
+  return traversal.pathTo(traversal.stopStep);
+}
+
+} // namespace
+
+auto PathFinder::buildPath(NetlistNode &startNode, NetlistNode &endNode)
+    -> NetlistPath {
+  if (&startNode == &endNode || !context.isVisited(endNode.getGraphIndex())) {
+    return {};
   }
   NetlistPath path;
   auto *nextNode = &endNode;
   path.add(endNode);
   do {
-    nextNode = traversalMap[nextNode];
+    nextNode = parents[nextNode->getGraphIndex()];
     SLANG_ASSERT(nextNode != nullptr);
     path.add(*nextNode);
   } while (nextNode != &startNode);
@@ -66,24 +88,162 @@ NetlistPath buildPath(TraversalMap &traversalMap, NetlistNode &startNode,
   return path;
 }
 
-} // namespace
+template <class EdgePredicate>
+auto PathFinder::search(NetlistNode &startNode, NetlistNode &endNode)
+    -> NetlistPath {
+  switch (mode) {
+  case Mode::DepthFirst: {
+    Visitor visitor(parents);
+    DepthFirstSearch<NetlistNode, NetlistEdge, Visitor, EdgePredicate> dfs(
+        context, visitor, startNode);
+    return buildPath(startNode, endNode);
+  }
+  case Mode::Shortest:
+    return searchBreadthFirst<EdgePredicate>(startNode, endNode);
+  case Mode::Bidirectional:
+    return searchBidirectional<EdgePredicate>(startNode, endNode);
+  }
+  SLANG_UNREACHABLE;
+}
+
+template <class EdgePredicate>
+auto PathFinder::searchBreadthFirst(NetlistNode &startNode,
+                                    NetlistNode &endNode) -> NetlistPath {
+  if (&startNode == &endNode) {
+    return {};
+  }
+  context.reset();
+  context.markVisited(startNode.getGraphIndex());
+  frontier.assign(1, &startNode);
+
+  // The first time the end is reached is by a path with the fewest edges.
+  for (size_t head = 0; head < frontier.size(); head++) {
+    auto *node = frontier[head];
+    for (auto const &edge : node->getOutEdges()) {
+      if (!EdgePredicate{}(*edge)) {
+        continue;
+      }
+      auto &target = edge->getTargetNode();
+      if (!context.markVisited(target.getGraphIndex())) {
+        continue;
+      }
+      setEntry(parents, target, node);
+      if (&target == &endNode) {
+        return buildPath(startNode, endNode);
+      }
+      frontier.push_back(&target);
+    }
+  }
+  return {};
+}
+
+template <class EdgePredicate>
+auto PathFinder::searchBidirectional(NetlistNode &startNode,
+                                     NetlistNode &endNode) -> NetlistPath {
+  if (&startNode == &endNode) {
+    return {};
+  }
+  context.reset();
+  backwardContext.reset();
+  context.markVisited(startNode.getGraphIndex());
+  backwardContext.markVisited(endNode.getGraphIndex());
+  frontier.assign(1, &startNode);
+  backwardFrontier.assign(1, &endNode);
+
+  // Each step expands one whole level of the smaller frontier and stops at
+  // the first node both searches have reached. No node had been reached by
+  // both before the step, so every path is longer than the two searched
+  // depths together, and the meeting node is on a path one edge longer:
+  // the shortest.
+  NetlistNode *meeting = nullptr;
+  while (meeting == nullptr && !frontier.empty() &&
+         !backwardFrontier.empty()) {
+    nextFrontier.clear();
+    if (frontier.size() <= backwardFrontier.size()) {
+      for (auto *node : frontier) {
+        for (auto const &edge : node->getOutEdges()) {
+          if (!EdgePredicate{}(*edge)) {
+            continue;
+          }
+          auto &target = edge->getTargetNode();
+          if (!context.markVisited(target.getGraphIndex())) {
+            continue;
+          }
+          setEntry(parents, target, node);
+          if (backwardContext.isVisited(target.getGraphIndex())) {
+            meeting = &target;
+            break;
+          }
+          nextFrontier.push_back(&target);
+        }
+        if (meeting != nullptr) {
+          break;
+        }
+      }
+      std::swap(frontier, nextFrontier);
+    } else {
+      for (auto *node : backwardFrontier) {
+        for (auto *edge : node->getInEdges()) {
+          if (!EdgePredicate{}(*edge)) {
+            continue;
+          }
+          auto &source = edge->getSourceNode();
+          if (!backwardContext.markVisited(source.getGraphIndex())) {
+            continue;
+          }
+          setEntry(children, source, node);
+          if (context.isVisited(source.getGraphIndex())) {
+            meeting = &source;
+            break;
+          }
+          nextFrontier.push_back(&source);
+        }
+        if (meeting != nullptr) {
+          break;
+        }
+      }
+      std::swap(backwardFrontier, nextFrontier);
+    }
+  }
+  if (meeting == nullptr) {
+    return {};
+  }
+
+  // Join the forward path to the meeting node with the backward path from
+  // it to the end.
+  NetlistPath path;
+  for (auto *node = meeting;; node = parents[node->getGraphIndex()]) {
+    path.add(*node);
+    if (node == &startNode) {
+      break;
+    }
+  }
+  path.reverse();
+  for (auto *node = meeting; node != &endNode;) {
+    node = children[node->getGraphIndex()];
+    path.add(*node);
+  }
+  return path;
+}
 
 auto PathFinder::find(NetlistNode &startNode, NetlistNode &endNode)
     -> NetlistPath {
-  TraversalMap traversalMap;
-  Visitor visitor(traversalMap);
-  DepthFirstSearch<NetlistNode, NetlistEdge, Visitor, EdgePredicate> dfs(
-      visitor, startNode);
-  return buildPath(traversalMap, startNode, endNode);
+  return search<EdgePredicate>(startNode, endNode);
 }
 
 auto PathFinder::findComb(NetlistNode &startNode, NetlistNode &endNode)
     -> NetlistPath {
-  TraversalMap traversalMap;
-  Visitor visitor(traversalMap);
-  DepthFirstSearch<NetlistNode, NetlistEdge, Visitor, CombEdgePredicate> dfs(
-      visitor, startNode);
-  return buildPath(traversalMap, startNode, endNode);
+  return search<CombEdgePredicate>(startNode, endNode);
+}
+
+auto PathFinder::find(NetlistNode &startNode, DriverBitRange bits,
+                      NetlistNode &endNode) -> NetlistPath {
+  return searchBits<EdgePredicate>(startNode, bits, endNode);
+}
+
+auto PathFinder::findComb(NetlistNode &startNode, DriverBitRange bits,
+                          NetlistNode &endNode) -> NetlistPath {
+  return searchBits<CombEdgePredicate>(startNode, bits, endNode);
 }
 
 } // namespace slang::netlist
@@ -1,5 +1,7 @@
 #include "PendingRvalueQueue.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <exception>
 #include <mutex>
 #include <unordered_map>
@@ -16,6 +18,10 @@ namespace {
 /// parallel task. nullptr when running sequentially.
 thread_local DeferredGraphWork *threadLocalDeferredWork = nullptr;
 
+/// Number of chunks per pool thread in the parallel resolve, so that a few
+/// expensive runs do not leave the other threads idle.
+constexpr size_t chunksPerThread = 4;
+
 } // namespace
 
 void PendingRvalueQueue::enqueue(ast::ValueSymbol const &symbol,
@@ -34,6 +40,27 @@ void PendingRvalueQueue::setTaskBuffer(DeferredGraphWork *buffer) {
   threadLocalDeferredWork = buffer;
 }
 
+auto PendingRvalueQueue::getTaskBuffer() const -> DeferredGraphWork * {
+  return threadLocalDeferredWork;
+}
+
+void PendingRvalueQueue::linkStagedEdges(
+    std::vector<DeferredGraphWork> &allWork, BS::thread_pool<> &threadPool,
+    BuildProfile &profile) {
+  using Clock = std::chrono::steady_clock;
+  auto t = Clock::now();
+  std::vector<std::vector<EdgeRecord>> buffers;
+  buffers.reserve(allWork.size());
+  for (auto &work : allWork) {
+    profile.stagedEdgeCount += work.edges.size();
+    buffers.push_back(std::move(work.edges));
+    work.edges.clear();
+  }
+  EdgeLinker::linkAll(buffers, threadPool);
+  profile.linkEdgesSeconds +=
+      std::chrono::duration<double>(Clock::now() - t).count();
+}
+
 void PendingRvalueQueue::drain(std::vector<DeferredGraphWork> &allWork,
                                BuildProfile &profile) {
   // Reserve in one shot so the per-task move-in below doesn't trigger
@@ -105,14 +132,14 @@ void PendingRvalueQueue::resolveSequential() {
   queue.clear();
 }
 
-void PendingRvalueQueue::resolveParallel(BS::thread_pool<> &threadPool) {
-  // Group pending R-values by target node so each target's incoming
-  // edges are emitted from a single thread. Sorting the queue in place
-  // + a one-shot run-start index avoids a per-target
-  // std::vector<size_t> in a hash map, which on large designs can be
-  // many MB of transient overhead. The original queue order is not
-  // preserved, but the queue is cleared at the end of this function so
-  // that has no observable effect.
+void PendingRvalueQueue::resolveParallel(BS::thread_pool<> &threadPool,
+                                         BuildProfile &profile) {
+  // Group pending R-values by target node so each target's incoming edges
+  // are resolved together by a single task. Sorting the queue in place and
+  // a one-shot run-start index avoid a per-target std::vector<size_t> in a
+  // hash map, which on large designs can be many MB of transient overhead.
+  // The original queue order is not preserved, but the queue is cleared at
+  // the end of this function so that has no observable effect.
   std::ranges::sort(queue, std::less<NetlistNode *>{}, &PendingRvalue::node);
 
   // Entries with node == nullptr cluster at the front; skip them.
@@ -135,24 +162,34 @@ void PendingRvalueQueue::resolveParallel(BS::thread_pool<> &threadPool) {
 
   size_t numRuns = runStarts.empty() ? 0 : runStarts.size() - 1;
 
+  // Split the runs into a fixed number of chunks, each with its own edge
+  // staging buffer, so the staged edges can be linked in a deterministic
+  // order regardless of which thread ran which chunk.
+  size_t numChunks =
+      std::min(numRuns, static_cast<size_t>(threadPool.get_thread_count()) *
+                            chunksPerThread);
+  std::vector<DeferredGraphWork> allWork(numChunks);
+
   std::mutex exceptionMutex;
   std::exception_ptr pendingException;
 
-  threadPool.detach_blocks(
-      static_cast<size_t>(0), numRuns, [&](size_t begin, size_t end) {
-        builder.clearThreadLocalSymbolRefCache();
-        for (size_t r = begin; r < end; ++r) {
-          for (size_t i = runStarts[r]; i < runStarts[r + 1]; ++i) {
-            SLANG_TRY { emitEdgesFor(queue[i]); }
-            SLANG_CATCH(const std::exception &) {
-              std::lock_guard<std::mutex> lock(exceptionMutex);
-              if (!pendingException) {
-                pendingException = std::current_exception();
-              }
-            }
+  threadPool.detach_loop(static_cast<size_t>(0), numChunks, [&](size_t c) {
+    setTaskBuffer(&allWork[c]);
+    builder.clearThreadLocalSymbolRefCache();
+    for (size_t r = c * numRuns / numChunks;
+         r < (c + 1) * numRuns / numChunks; ++r) {
+      for (size_t i = runStarts[r]; i < runStarts[r + 1]; ++i) {
+        SLANG_TRY { emitEdgesFor(queue[i]); }
+        SLANG_CATCH(const std::exception &) {
+          std::lock_guard<std::mutex> lock(exceptionMutex);
+          if (!pendingException) {
+            pendingException = std::current_exception();
           }
         }
-      });
+      }
+    }
+    setTaskBuffer(nullptr);
+  });
 
   threadPool.wait();
 
@@ -160,16 +197,18 @@ void PendingRvalueQueue::resolveParallel(BS::thread_pool<> &threadPool) {
     std::rethrow_exception(pendingException);
   }
 
+  linkStagedEdges(allWork, threadPool, profile);
   queue.clear();
 }
 
-void PendingRvalueQueue::resolve(BS::thread_pool<> *threadPool) {
+void PendingRvalueQueue::resolve(BS::thread_pool<> *threadPool,
+                                 BuildProfile &profile) {
   if (!builder.options.parallel || threadPool == nullptr ||
       queue.size() < builder.options.parallelRValueThreshold) {
     resolveSequential();
     return;
   }
-  resolveParallel(*threadPool);
+  resolveParallel(*threadPool, profile);
 }
 
 } // namespace slang::netlist
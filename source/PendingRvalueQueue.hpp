@@ -4,6 +4,7 @@
 
 #include <BS_thread_pool.hpp>
 
+#include "EdgeLinker.hpp"
 #include "PendingRValue.hpp"
 
 #include "netlist/BuildProfile.hpp"
@@ -12,11 +13,12 @@ namespace slang::netlist {
 
 class NetlistBuilder;
 
-/// Thread-local accumulator for deferred pending R-values produced by
-/// one parallel Phase 2 task. Held by value in a per-task slot so the
-/// dispatch loop can also record wall-clock time.
+/// Thread-local accumulator for deferred graph work produced by one
+/// parallel task: pending R-values and staged edges. Held by value in a
+/// per-task slot so the dispatch loop can also record wall-clock time.
 struct DeferredGraphWork {
   std::vector<PendingRvalue> pendingRValues;
+  std::vector<EdgeRecord> edges;
   double elapsedSeconds = 0; // Wall-clock time for this task.
 };
 
@@ -29,7 +31,10 @@ struct DeferredGraphWork {
 /// avoid contention on the shared queue. After Phase 2 the per-task
 /// buffers are drained back into the main queue. Outside of Phase 2
 /// (sequential Phase 2, the modport fast path inside the builder),
-/// `enqueue` pushes directly to the main queue.
+/// `enqueue` pushes directly to the main queue. The same per-task
+/// buffer also stages the edges added by the task (see
+/// NetlistBuilder::addDependency), which are linked in bulk once the
+/// tasks have finished.
 class PendingRvalueQueue {
 public:
   explicit PendingRvalueQueue(NetlistBuilder &builder) : builder(builder) {}
@@ -47,6 +52,17 @@ public:
   /// to revert to the shared-queue path.
   void setTaskBuffer(DeferredGraphWork *buffer);
 
+  /// Return the current thread's per-task buffer, or nullptr outside of
+  /// a parallel task.
+  auto getTaskBuffer() const -> DeferredGraphWork *;
+
+  /// Link the edges staged in @p allWork's per-task buffers into the
+  /// graph, in task order. Updates `profile.stagedEdgeCount` and
+  /// `profile.linkEdgesSeconds`.
+  static void linkStagedEdges(std::vector<DeferredGraphWork> &allWork,
+                              BS::thread_pool<> &threadPool,
+                              BuildProfile &profile);
+
   /// Move the contents of @p allWork's per-task buffers into the
   /// main queue. Updates `profile.deferredPendingRValueCount`.
   void drain(std::vector<DeferredGraphWork> &allWork, BuildProfile &profile);
@@ -54,14 +70,16 @@ public:
   /// Resolve every queued pending R-value into edges. Picks
   /// sequential or parallel based on builder options and the size
   /// of the queue. @p threadPool may be null for sequential builds.
-  void resolve(BS::thread_pool<> *threadPool);
+  /// Updates the edge-linking fields of @p profile.
+  void resolve(BS::thread_pool<> *threadPool, BuildProfile &profile);
 
 private:
   /// Sequential path: walk the queue and emit edges directly.
   void resolveSequential();
 
-  /// Parallel path: partition by target node and dispatch chunks.
-  void resolveParallel(BS::thread_pool<> &threadPool);
+  /// Parallel path: partition by target node and dispatch chunks,
+  /// staging each chunk's edges and linking them in bulk afterwards.
+  void resolveParallel(BS::thread_pool<> &threadPool, BuildProfile &profile);
 
   /// Emit the edges implied by one pending R-value.
   void emitEdgesFor(PendingRvalue const &pending);
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include <BS_thread_pool.hpp>
+
+namespace slang::netlist {
+
+/// The worker threads a NetlistGraph shares between findNodesRegex, the
+/// indexes it builds on demand and the analyses built over it, so that
+/// none of them starts threads of its own. The threads are started on
+/// first use, with the thread count of the graph's last build.
+///
+/// Several callers may use the pool at once, so each waits only on the
+/// tasks it submitted. A task running on the pool must not wait on it.
+class QueryPool {
+public:
+  explicit QueryPool(unsigned numThreads) : numThreads(numThreads) {}
+
+  /// Return true if the graph was built with a single thread, in which
+  /// case callers run their work on the calling thread instead.
+  [[nodiscard]] auto isSerial() const -> bool { return numThreads == 1; }
+
+  /// Return the number of threads of the pool, starting them if needed.
+  [[nodiscard]] auto getThreadCount() -> size_t {
+    return static_cast<size_t>(getPool().get_thread_count());
+  }
+
+  /// Run body(i) for each i in [0, count) on the pool and wait for them.
+  template <typename Body> void forEach(size_t count, Body &&body) {
+    getPool().submit_loop(size_t{0}, count, std::forward<Body>(body)).wait();
+  }
+
+private:
+  auto getPool() -> BS::thread_pool<> & {
+    std::call_once(started, [this] {
+      threadPool = std::make_unique<BS::thread_pool<>>(numThreads);
+    });
+    return *threadPool;
+  }
+
+  unsigned numThreads;
+  std::once_flag started;
+  std::unique_ptr<BS::thread_pool<>> threadPool;
+};
+
+} // namespace slang::netlist
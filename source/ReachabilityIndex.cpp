@@ -0,0 +1,249 @@
+#include "netlist/ReachabilityIndex.hpp"
+
+#include "StronglyConnectedComponents.hpp"
+
+#include "slang/util/Util.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+using namespace slang::netlist;
+
+namespace {
+
+constexpr auto unvisited = std::numeric_limits<uint32_t>::max();
+
+} // namespace
+
+ReachabilityIndex::ReachabilityIndex(NetlistGraph const &graph)
+    : graph(graph) {
+  SLANG_ASSERT(!graph.hasReleasedEdges());
+  auto const numNodes = graph.numNodes();
+
+  // The combinational edges: enabled, and not into a State node.
+  firstSuccessor.reserve(numNodes + 1);
+  firstSuccessor.push_back(0);
+  if (auto const *frozen = graph.getFrozen()) {
+    for (FrozenNetlist::NodeIndex node = 0; node < numNodes; node++) {
+      for (auto edge : frozen->outEdges(node)) {
+        auto target = frozen->getTarget(edge);
+        if (!frozen->isDisabled(edge) &&
+            frozen->getKind(target) != NodeKind::State) {
+          successors.push_back(target);
+        }
+      }
+      firstSuccessor.push_back(static_cast<uint32_t>(successors.size()));
+    }
+  } else {
+    for (auto const &node : graph) {
+      for (auto const &edge : node->getOutEdges()) {
+        auto const &target = edge->getTargetNode();
+        if (!edge->disabled && target.kind != NodeKind::State) {
+          successors.push_back(static_cast<uint32_t>(target.getGraphIndex()));
+        }
+      }
+      firstSuccessor.push_back(static_cast<uint32_t>(successors.size()));
+    }
+  }
+
+  // Components are numbered when they are complete, after every component
+  // they reach.
+  StronglyConnectedComponents scc(firstSuccessor, successors);
+  auto const numComponents = scc.numComponents;
+
+  // The condensation DAG, without duplicate edges. Grouping the nodes by
+  // component first lets each component's edges be gathered together.
+  std::vector<uint32_t> firstMember;
+  std::vector<uint32_t> members;
+  scc.groupMembers(firstMember, members);
+  components = std::move(scc.components);
+  firstDagSuccessor.reserve(numComponents + 1);
+  firstDagSuccessor.push_back(0);
+  std::vector<uint32_t> lastSource(numComponents, unvisited);
+  std::vector<uint32_t> dagInDegree(numComponents, 0);
+  for (uint32_t c = 0; c < numComponents; c++) {
+    for (auto m = firstMember[c]; m < firstMember[c + 1]; m++) {
+      auto node = members[m];
+      for (auto e = firstSuccessor[node]; e < firstSuccessor[node + 1]; e++) {
+        auto target = components[successors[e]];
+        if (target != c && lastSource[target] != c) {
+          lastSource[target] = c;
+          dagSuccessors.push_back(target);
+          dagInDegree[target]++;
+        }
+      }
+    }
+    firstDagSuccessor.push_back(static_cast<uint32_t>(dagSuccessors.size()));
+  }
+
+  // Label the components with depth-first traversals of the DAG from its
+  // roots, visiting roots and successors in a different order each time so
+  // that the labels rule out different pairs.
+  labels.resize(numComponents);
+  std::vector<uint32_t> roots;
+  for (uint32_t c = 0; c < numComponents; c++) {
+    if (dagInDegree[c] == 0) {
+      roots.push_back(c);
+    }
+  }
+  std::vector<uint32_t> visited(numComponents, unvisited);
+  std::vector<std::pair<uint32_t, uint32_t>> stack;
+  for (uint32_t t = 0; t < numTraversals; t++) {
+    bool const reversed = t % 2 == 1;
+    uint32_t preCounter = 0;
+    uint32_t postCounter = 0;
+    auto visit = [&](uint32_t c) {
+      visited[c] = t;
+      labels[c][t].pre = preCounter++;
+      stack.emplace_back(c, 0);
+    };
+    for (size_t r = 0; r < roots.size(); r++) {
+      auto root = reversed ? roots[r] : roots[roots.size() - 1 - r];
+      if (visited[root] == t) {
+        continue;
+      }
+      visit(root);
+      while (!stack.empty()) {
+        auto &[c, pos] = stack.back();
+        auto const first = firstDagSuccessor[c];
+        auto const count = firstDagSuccessor[c + 1] - first;
+        if (pos < count) {
+          auto next =
+              dagSuccessors[first + (reversed ? count - 1 - pos : pos)];
+          pos++;
+          if (visited[next] != t) {
+            visit(next);
+          }
+          continue;
+        }
+        auto &label = labels[c][t];
+        label.post = postCounter++;
+        label.low = label.post;
+        for (auto e = first; e < first + count; e++) {
+          label.low = std::min(label.low, labels[dagSuccessors[e]][t].low);
+        }
+        stack.pop_back();
+      }
+    }
+  }
+}
+
+auto ReachabilityIndex::mayReach(uint32_t from, uint32_t to) const -> bool {
+  if (from < to) {
+    return false;
+  }
+  for (size_t t = 0; t < numTraversals; t++) {
+    auto const &outer = labels[from][t];
+    auto const &inner = labels[to][t];
+    if (inner.low < outer.low || inner.post > outer.post) {
+      return false;
+    }
+  }
+  return true;
+}
+
+auto ReachabilityIndex::mustReach(uint32_t from, uint32_t to) const -> bool {
+  for (size_t t = 0; t < numTraversals; t++) {
+    auto const &ancestor = labels[from][t];
+    auto const &descendant = labels[to][t];
+    if (ancestor.pre <= descendant.pre && descendant.post <= ancestor.post) {
+      return true;
+    }
+  }
+  return false;
+}
+
+auto ReachabilityIndex::reaches(NetlistNode const &from,
+                                NetlistNode const &to) const -> bool {
+  TraversalContext context;
+  return reaches(from, to, context);
+}
+
+auto ReachabilityIndex::reaches(NetlistNode const &from, NetlistNode const &to,
+                                TraversalContext &context) const -> bool {
+  SLANG_ASSERT(graph.findNode(from) < components.size());
+  SLANG_ASSERT(graph.findNode(to) < components.size());
+  auto const source = getComponent(from);
+  auto const target = getComponent(to);
+  if (source == target) {
+    return true;
+  }
+  if (!mayReach(source, target)) {
+    return false;
+  }
+  if (mustReach(source, target)) {
+    return true;
+  }
+
+  // Search the DAG, entering only the components the labels leave open.
+  context.reset(labels.size());
+  context.markVisited(source);
+  std::vector<uint32_t> stack{source};
+  while (!stack.empty()) {
+    auto c = stack.back();
+    stack.pop_back();
+    for (auto e = firstDagSuccessor[c]; e < firstDagSuccessor[c + 1]; e++) {
+      auto next = dagSuccessors[e];
+      if (next == target) {
+        return true;
+      }
+      if (!context.markVisited(next) || !mayReach(next, target)) {
+        continue;
+      }
+      if (mustReach(next, target)) {
+        return true;
+      }
+      stack.push_back(next);
+    }
+  }
+  return false;
+}
+
+auto ReachabilityIndex::findPath(NetlistNode &from, NetlistNode &to) const
+    -> NetlistPath {
+  TraversalContext context;
+  return findPath(from, to, context);
+}
+
+auto ReachabilityIndex::findPath(NetlistNode &from, NetlistNode &to,
+                                 TraversalContext &context) const
+    -> NetlistPath {
+  if (!reaches(from, to, context)) {
+    return {};
+  }
+  if (&from == &to) {
+    return NetlistPath({&from});
+  }
+
+  // A depth-first search of the graph that skips the nodes whose component
+  // cannot reach the target, so it runs close to straight down a path. The
+  // search stack is the path when the target is found.
+  auto const start = static_cast<uint32_t>(from.getGraphIndex());
+  auto const end = static_cast<uint32_t>(to.getGraphIndex());
+  auto const target = components[end];
+  context.reset(components.size());
+  context.markVisited(start);
+  std::vector<std::pair<uint32_t, uint32_t>> stack;
+  stack.emplace_back(start, firstSuccessor[start]);
+  while (!stack.empty()) {
+    auto &[node, edge] = stack.back();
+    if (edge == firstSuccessor[node + 1]) {
+      stack.pop_back();
+      continue;
+    }
+    auto next = successors[edge++];
+    if (next == end) {
+      NetlistPath path;
+      for (auto const &entry : stack) {
+        path.add(graph.getNode(entry.first));
+      }
+      path.add(to);
+      return path;
+    }
+    if (context.markVisited(next) && mayReach(components[next], target)) {
+      stack.emplace_back(next, firstSuccessor[next]);
+    }
+  }
+  SLANG_UNREACHABLE;
+}
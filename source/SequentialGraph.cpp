@@ -0,0 +1,141 @@
+#include "netlist/SequentialGraph.hpp"
+
+#include "netlist/NetlistGraph.hpp"
+#include "netlist/TraversalContext.hpp"
+
+#include "QueryPool.hpp"
+
+#include <algorithm>
+
+using namespace slang::netlist;
+
+namespace {
+
+/// Graphs with fewer nodes than this are searched on the calling thread.
+constexpr size_t parallelThreshold = 256;
+
+/// Number of nodes each task searches from.
+constexpr size_t sourcesPerTask = 64;
+
+} // namespace
+
+auto SequentialGraph::isEndpoint(NetlistNode const &node) -> bool {
+  if (node.kind == NodeKind::State) {
+    return true;
+  }
+  if (node.kind != NodeKind::Port) {
+    return false;
+  }
+  return node.as<Port>().symbol->scope->depth == 1;
+}
+
+SequentialGraph::SequentialGraph(NetlistGraph const &graph, QueryPool &pool)
+    : netlist(graph), version(graph.getNodeListVersion()) {
+  SLANG_ASSERT(!graph.hasReleasedEdges());
+  auto const numGraphNodes = graph.numNodes();
+  indices.assign(numGraphNodes, null_index);
+  for (auto const &node : graph) {
+    if (isEndpoint(*node)) {
+      indices[node->getGraphIndex()] = static_cast<NodeIndex>(nodes.size());
+      nodes.push_back(node.get());
+    }
+  }
+
+  // The edges a search follows, by graph index: enabled edges into
+  // non-State nodes, and enabled data edges into State nodes, where the
+  // search stops. Clock and reset edges are not data connections.
+  std::vector<uint32_t> firstEdge;
+  std::vector<uint32_t> edgeTargets;
+  std::vector<uint8_t> stops(numGraphNodes, 0);
+  firstEdge.reserve(numGraphNodes + 1);
+  firstEdge.push_back(0);
+  for (auto const &node : graph) {
+    stops[node->getGraphIndex()] = node->kind == NodeKind::State;
+    for (auto const &edge : node->getOutEdges()) {
+      auto const &target = edge->getTargetNode();
+      if (edge->disabled || (target.kind == NodeKind::State &&
+                             edge->edgeKind != slang::ast::EdgeKind::None)) {
+        continue;
+      }
+      edgeTargets.push_back(static_cast<uint32_t>(target.getGraphIndex()));
+    }
+    firstEdge.push_back(static_cast<uint32_t>(edgeTargets.size()));
+  }
+
+  // Search from each node for the nodes it reaches. Each task has its own
+  // scratch storage and writes only the entries of its own sources.
+  std::vector<std::vector<NodeIndex>> reached(nodes.size());
+  auto const numBlocks = (nodes.size() + sourcesPerTask - 1) / sourcesPerTask;
+  auto searchBlock = [&](size_t block) {
+    TraversalContext context;
+    std::vector<uint32_t> stack;
+    auto end = std::min(nodes.size(), (block + 1) * sourcesPerTask);
+    for (auto source = block * sourcesPerTask; source < end; source++) {
+      auto &result = reached[source];
+      auto start = static_cast<uint32_t>(nodes[source]->getGraphIndex());
+      context.reset(numGraphNodes);
+      context.markVisited(start);
+      stack.push_back(start);
+      while (!stack.empty()) {
+        auto node = stack.back();
+        stack.pop_back();
+        for (auto e = firstEdge[node]; e < firstEdge[node + 1]; e++) {
+          auto target = edgeTargets[e];
+          if (indices[target] != null_index) {
+            result.push_back(indices[target]);
+          }
+          if (stops[target] == 0 && context.markVisited(target)) {
+            stack.push_back(target);
+          }
+        }
+      }
+      std::ranges::sort(result);
+      auto [first, last] = std::ranges::unique(result);
+      result.erase(first, last);
+    }
+  };
+  if (nodes.size() >= parallelThreshold && !pool.isSerial()) {
+    pool.forEach(numBlocks, searchBlock);
+  } else {
+    for (size_t block = 0; block < numBlocks; block++) {
+      searchBlock(block);
+    }
+  }
+
+  // Flatten the successor lists, and count sort them into predecessor
+  // lists, which are then in ascending order too.
+  firstTarget.reserve(nodes.size() + 1);
+  firstTarget.push_back(0);
+  firstSource.assign(nodes.size() + 1, 0);
+  for (auto const &result : reached) {
+    targets.insert(targets.end(), result.begin(), result.end());
+    firstTarget.push_back(static_cast<uint32_t>(targets.size()));
+    for (auto target : result) {
+      firstSource[target + 1]++;
+    }
+  }
+  for (size_t n = 0; n < nodes.size(); n++) {
+    firstSource[n + 1] += firstSource[n];
+  }
+  sources.resize(targets.size());
+  auto next = firstSource;
+  for (NodeIndex source = 0; source < nodes.size(); source++) {
+    for (auto target : successors(source)) {
+      sources[next[target]++] = source;
+    }
+  }
+}
+
+auto SequentialGraph::isCurrent() const -> bool {
+  return netlist.getNodeListVersion() == version;
+}
+
+auto SequentialGraph::getIndex(NetlistNode const &node) const -> NodeIndex {
+  SLANG_ASSERT(isCurrent());
+  auto index = node.getGraphIndex();
+  if (index < indices.size() && indices[index] != null_index &&
+      nodes[indices[index]] == &node) {
+    return indices[index];
+  }
+  return null_index;
+}
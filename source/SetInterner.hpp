@@ -0,0 +1,82 @@
+#pragma once
+
+#include "slang/util/FlatMap.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace slang::netlist {
+
+/// A store of sets of 64-bit keys, for passes that label every node of a
+/// graph with a set when most nodes share one of a few sets. Each distinct
+/// set is stored once and numbered in the order it is first seen, with the
+/// empty set numbered 0, and the union of two numbered sets is computed
+/// once.
+class SetInterner {
+public:
+  using SetIndex = uint32_t;
+
+  /// A set, as a sorted list of distinct keys.
+  using KeySet = std::vector<uint64_t>;
+
+  static constexpr SetIndex empty_set = 0;
+
+  SetInterner() : sets(1) { interned.emplace(KeySet{}, empty_set); }
+
+  /// Return the number of @p set, which must be sorted and distinct.
+  auto intern(KeySet &&set) -> SetIndex {
+    auto [it, inserted] =
+        interned.try_emplace(set, static_cast<SetIndex>(sets.size()));
+    if (inserted) {
+      sets.push_back(std::move(set));
+    }
+    return it->second;
+  }
+
+  /// Return the number of the union of sets @p a and @p b.
+  auto unite(SetIndex a, SetIndex b) -> SetIndex {
+    if (a == b || b == empty_set) {
+      return a;
+    }
+    if (a == empty_set) {
+      return b;
+    }
+    auto key = (static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b);
+    if (auto it = unions.find(key); it != unions.end()) {
+      return it->second;
+    }
+    KeySet merged;
+    std::ranges::set_union(sets[a], sets[b], std::back_inserter(merged));
+    auto result = intern(std::move(merged));
+    unions.emplace(key, result);
+    return result;
+  }
+
+  /// Return the number of distinct sets.
+  [[nodiscard]] auto size() const -> size_t { return sets.size(); }
+
+  /// Return the keys of set @p index.
+  [[nodiscard]] auto operator[](SetIndex index) const -> KeySet const & {
+    return sets[index];
+  }
+
+private:
+  struct KeySetHash {
+    auto operator()(KeySet const &set) const -> size_t {
+      size_t hash = set.size();
+      for (auto key : set) {
+        hash = (hash ^ key) * 0x9e3779b97f4a7c15ULL;
+      }
+      return hash;
+    }
+  };
+
+  std::vector<KeySet> sets;
+  flat_hash_map<KeySet, SetIndex, KeySetHash> interned;
+  flat_hash_map<uint64_t, SetIndex> unions;
+};
+
+} // namespace slang::netlist
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace slang::netlist {
+
+/// The strongly connected components of a graph given in compressed sparse
+/// row form: the successors of node n are targets[firstEdge[n]] up to
+/// targets[firstEdge[n + 1]].
+///
+/// Components are found with an iterative form of Tarjan's algorithm and
+/// numbered as they are completed, so every edge between two components
+/// leads from a higher number to a lower one, and visiting components in
+/// ascending order visits each after every component it reaches.
+struct StronglyConnectedComponents {
+  static constexpr auto unvisited = std::numeric_limits<uint32_t>::max();
+
+  /// The component of each node.
+  std::vector<uint32_t> components;
+
+  /// The number of components.
+  uint32_t numComponents = 0;
+
+  StronglyConnectedComponents(std::vector<uint32_t> const &firstEdge,
+                              std::vector<uint32_t> const &targets) {
+    auto const numNodes = static_cast<uint32_t>(firstEdge.size() - 1);
+    components.assign(numNodes, unvisited);
+    std::vector<uint32_t> order(numNodes, unvisited);
+    std::vector<uint32_t> lowLink(numNodes);
+    std::vector<uint32_t> open;
+    std::vector<std::pair<uint32_t, uint32_t>> callStack;
+    uint32_t counter = 0;
+    auto enter = [&](uint32_t node) {
+      order[node] = lowLink[node] = counter++;
+      open.push_back(node);
+      callStack.emplace_back(node, firstEdge[node]);
+    };
+    for (uint32_t root = 0; root < numNodes; root++) {
+      if (order[root] != unvisited) {
+        continue;
+      }
+      enter(root);
+      while (!callStack.empty()) {
+        auto &[node, edge] = callStack.back();
+        if (edge < firstEdge[node + 1]) {
+          auto next = targets[edge++];
+          if (order[next] == unvisited) {
+            enter(next);
+          } else if (components[next] == unvisited) {
+            // Still open, so on the current path or in an unfinished
+            // component below it.
+            lowLink[node] = std::min(lowLink[node], order[next]);
+          }
+          continue;
+        }
+        auto done = node;
+        callStack.pop_back();
+        if (!callStack.empty()) {
+          auto parent = callStack.back().first;
+          lowLink[parent] = std::min(lowLink[parent], lowLink[done]);
+        }
+        if (lowLink[done] == order[done]) {
+          uint32_t member;
+          do {
+            member = open.back();
+            open.pop_back();
+            components[member] = numComponents;
+          } while (member != done);
+          numComponents++;
+        }
+      }
+    }
+  }
+
+  /// Return the nodes of each component, grouped by component: the members
+  /// of component c are members[firstMember[c]] up to
+  /// members[firstMember[c + 1]], in ascending order.
+  void groupMembers(std::vector<uint32_t> &firstMember,
+                    std::vector<uint32_t> &members) const {
+    firstMember.assign(numComponents + 1, 0);
+    for (auto component : components) {
+      firstMember[component + 1]++;
+    }
+    for (size_t c = 0; c < numComponents; c++) {
+      firstMember[c + 1] += firstMember[c];
+    }
+    members.resize(components.size());
+    auto next = firstMember;
+    for (uint32_t node = 0; node < components.size(); node++) {
+      members[next[components[node]]++] = node;
+    }
+  }
+};
+
+} // namespace slang::netlist
@@ -101,6 +101,174 @@ class TestNetlistGraph(unittest.TestCase):
         # A combinatorial path exists from a to c.
         self.assertFalse(finder.find_comb(start, comb_end).empty())
 
+    def test_find_shortest_path(self):
+        code = """
+        module m(input logic a, output logic b);
+            logic x, y;
+            assign x = a;
+            assign y = x;
+            assign b = y | a;
+        endmodule
+        """
+        test = NetlistGraphTest(code)
+        start = test.graph.lookup("m.a")
+        end = test.graph.lookup("m.b")
+        finder = pyslang_netlist.PathFinder()
+        self.assertEqual(finder.mode, pyslang_netlist.PathFinder.Mode.DepthFirst)
+        first = finder.find(start, end)
+        shortest = pyslang_netlist.PathFinder(
+            pyslang_netlist.PathFinder.Mode.Shortest
+        ).find(start, end)
+        finder.mode = pyslang_netlist.PathFinder.Mode.Bidirectional
+        both = finder.find(start, end)
+        for path in (shortest, both):
+            self.assertEqual(path.front().name, "a")
+            self.assertEqual(path.back().name, "b")
+            self.assertLessEqual(len(path), len(first))
+        self.assertEqual(len(shortest), len(both))
+        # The same node is not a path in any mode.
+        self.assertTrue(finder.find(start, start).empty())
+
+    def test_path_enumerator(self):
+        code = """
+        module m(input logic a, output logic b);
+            logic x, y;
+            assign x = a;
+            assign y = a;
+            assign b = x | y | a;
+        endmodule
+        """
+        test = NetlistGraphTest(code)
+        start = test.graph.lookup("m.a")
+        end = test.graph.lookup("m.b")
+        Status = pyslang_netlist.PathEnumerator.Status
+        paths = pyslang_netlist.PathEnumerator(start, end)
+        found = [tuple(id(node) for node in path) for path in paths]
+        self.assertGreaterEqual(len(found), 3)
+        self.assertEqual(len(set(found)), len(found))
+        self.assertEqual(paths.num_paths(), len(found))
+        self.assertEqual(paths.status, Status.Exhausted)
+        limited = pyslang_netlist.PathEnumerator(start, end, max_paths=2)
+        self.assertEqual(len(list(limited)), 2)
+        self.assertEqual(limited.status, Status.PathLimit)
+
+    def test_reachability_index(self):
+        code = """
+        module m(input clk, input logic a, output logic b, output logic c);
+            always_ff @(posedge clk)
+                b <= a;
+            assign c = a;
+        endmodule
+        """
+        test = NetlistGraphTest(code)
+        start = test.graph.lookup("m.a")
+        seq_end = test.graph.lookup("m.b")
+        comb_end = test.graph.lookup("m.c")
+        index = pyslang_netlist.ReachabilityIndex(test.graph)
+        self.assertFalse(index.reaches(start, seq_end))
+        self.assertTrue(index.reaches(start, comb_end))
+        self.assertFalse(index.reaches(comb_end, start))
+        self.assertTrue(index.find_path(start, seq_end).empty())
+        path = index.find_path(start, comb_end)
+        self.assertFalse(path.empty())
+
+    def test_sequential_graph(self):
+        code = """
+        module m(input clk, input logic a, output logic y);
+            logic q;
+            always_ff @(posedge clk)
+                q <= a;
+            assign y = q;
+        endmodule
+        """
+        test = NetlistGraphTest(code)
+        seq = test.graph.get_sequential_graph()
+        paths = {n.path for n in seq.nodes()}
+        self.assertIn("m.q", paths)
+        self.assertIn("m.a", paths)
+        a = test.graph.lookup("m.a")
+        q = next(n for n in seq.nodes() if n.path == "m.q")
+        self.assertIn(q.ID, {n.ID for n in seq.successors(a)})
+        self.assertIn(a.ID, {n.ID for n in seq.predecessors(q)})
+        self.assertGreater(seq.num_edges(), 0)
+
+    def test_clock_domain_map(self):
+        code = """
+        module m(input clk, input clk2, input logic a, input logic b,
+                 output logic q1, output logic q2, output logic z);
+            always_ff @(posedge clk)
+                q1 <= a;
+            always_ff @(posedge clk2)
+                q2 <= a;
+            assign z = b;
+        endmodule
+        """
+        test = NetlistGraphTest(code)
+        domains = pyslang_netlist.ClockDomainMap(test.graph)
+        a = test.graph.lookup("m.a")
+        b = test.graph.lookup("m.b")
+        for node in (a, b):
+            expected = {(s.ID, k) for s, k in test.graph.get_sensitivity(node)}
+            actual = {(s.ID, k) for s, k in domains.get_sensitivity(node)}
+            self.assertEqual(actual, expected)
+        self.assertEqual(len(domains.get_sensitivity(a)), 2)
+        self.assertEqual(domains.get_domain(b), 0)
+        self.assertEqual(domains.get_sources(0), [])
+        self.assertGreaterEqual(domains.num_domains(), 4)
+
+    def test_constant_driver_map(self):
+        code = """
+        module m(input clk, input logic a, output logic y_tied,
+                 output logic y_real, output logic y_reg);
+            logic q;
+            always_ff @(posedge clk)
+                q <= a;
+            assign y_tied = 1'b1;
+            assign y_real = a;
+            assign y_reg = q;
+        endmodule
+        """
+        test = NetlistGraphTest(code)
+        constants = pyslang_netlist.ConstantDriverMap(test.graph)
+        DriveKind = pyslang_netlist.ConstantDriverMap.DriveKind
+        tied = test.graph.lookup("m.y_tied")
+        self.assertEqual(constants.get_drive_kind(tied), DriveKind.Constant)
+        self.assertEqual(
+            {n.ID for n in constants.get_constant_drivers(tied)},
+            {n.ID for n in test.graph.get_constant_drivers(tied)},
+        )
+        self.assertEqual(len(constants.get_constant_drivers(tied)), 1)
+        real = test.graph.lookup("m.y_real")
+        self.assertEqual(constants.get_drive_kind(real), DriveKind.External)
+        self.assertEqual(constants.get_constant_drivers(real), [])
+        reg = test.graph.lookup("m.y_reg")
+        self.assertEqual(constants.get_drive_kind(reg), DriveKind.State)
+
+    def test_logic_levels(self):
+        code = """
+        module m(input clk, input logic a, input logic b, output logic y);
+            logic q, r, t;
+            always_ff @(posedge clk)
+                q <= a;
+            assign t = q & b;
+            always_ff @(posedge clk)
+                r <= t | a;
+            assign y = r;
+        endmodule
+        """
+        test = NetlistGraphTest(code)
+        levels = pyslang_netlist.LogicLevels(test.graph)
+        q = test.graph.lookup("m.q")
+        r = test.graph.lookup("m.r")
+        self.assertGreaterEqual(levels.get_depth(q), 1)
+        self.assertGreater(levels.get_depth(r), levels.get_depth(q))
+        self.assertEqual(levels.get_level(q), 0)
+        self.assertGreaterEqual(levels.max_level(), levels.get_depth(r))
+        self.assertEqual(levels.get_endpoints_by_depth()[0].ID, r.ID)
+        path = levels.get_deepest_path(r)
+        self.assertGreater(len(path), 2)
+        self.assertEqual(path[len(path) - 1].ID, r.ID)
+
     def test_lookup_by_range(self):
         code = """
         module m(input logic [7:0] a, output logic [7:0] b);
@@ -180,6 +348,62 @@ class TestNetlistGraph(unittest.TestCase):
         self.assertIn("m.x", names)
         self.assertNotIn("m.y", names)
 
+    def test_comb_fan_bits(self):
+        code = """
+        module m(input logic [7:0] a, output logic [3:0] x,
+                 output logic [3:0] y);
+            assign x = a[3:0];
+            assign y = a[7:4];
+        endmodule
+        """
+        test = NetlistGraphTest(code)
+        a = test.graph.lookup("m.a")
+        cone = test.graph.get_comb_fan_out_bits(a, 5, 5)
+        bits = {
+            n.path: [tuple(r) for r in ranges]
+            for n, ranges in cone
+            if hasattr(n, "path")
+        }
+        self.assertEqual(bits["m.a"], [(5, 5)])
+        self.assertIn("m.y", bits)
+        self.assertNotIn("m.x", bits)
+        fan_in = test.graph.get_comb_fan_in_bits(test.graph.lookup("m.x"), 0, 0)
+        self.assertIn("m.a", {n.path for n, _ in fan_in if hasattr(n, "path")})
+
+        finder = pyslang_netlist.PathFinder()
+        x = test.graph.lookup("m.x")
+        y = test.graph.lookup("m.y")
+        self.assertEqual(len(finder.find_bits(a, 5, 5, x)), 0)
+        self.assertGreater(len(finder.find_comb_bits(a, 5, 5, y)), 0)
+
+    def test_comb_fan_many(self):
+        code = """
+        module m(input logic a, input logic b, output logic x, output logic y);
+            assign x = a;
+            assign y = a & b;
+        endmodule
+        """
+        test = NetlistGraphTest(code)
+        sources = [test.graph.lookup("m.a"), test.graph.lookup("m.b")]
+        fan_outs = test.graph.get_comb_fan_out_many(sources)
+        self.assertEqual(len(fan_outs), 2)
+        for source, fan_out in zip(sources, fan_outs):
+            expected = {n.ID for n in test.graph.get_comb_fan_out(source)}
+            self.assertEqual({n.ID for n in fan_out}, expected)
+        self.assertEqual(
+            test.graph.get_comb_fan_out_counts(sources),
+            [len(fan_out) for fan_out in fan_outs],
+        )
+        sinks = [test.graph.lookup("m.x"), test.graph.lookup("m.y")]
+        fan_ins = test.graph.get_comb_fan_in_many(sinks)
+        for sink, fan_in in zip(sinks, fan_ins):
+            expected = {n.ID for n in test.graph.get_comb_fan_in(sink)}
+            self.assertEqual({n.ID for n in fan_in}, expected)
+        self.assertEqual(
+            test.graph.get_comb_fan_in_counts(sinks),
+            [len(fan_in) for fan_in in fan_ins],
+        )
+
     def test_find_nodes_wildcard(self):
         code = """
         module m(input logic a, input logic b, output logic x, output logic y);
@@ -193,6 +417,23 @@ class TestNetlistGraph(unittest.TestCase):
         none = test.graph.find_nodes("z.*")
         self.assertEqual(len(none), 0)
 
+    def test_find_nodes_in_scope(self):
+        code = """
+        module sub(input logic d, output logic q);
+            assign q = d;
+        endmodule
+        module top(input logic a, output logic b, output logic c);
+            sub u0(.d(a), .q(b));
+            sub u01(.d(a), .q(c));
+        endmodule
+        """
+        test = NetlistGraphTest(code)
+        nodes = test.graph.find_nodes_in_scope("top.u0")
+        self.assertGreater(len(nodes), 0)
+        for node in nodes:
+            self.assertTrue(node.path == "top.u0" or node.path.startswith("top.u0."))
+        self.assertEqual(len(test.graph.find_nodes_in_scope("top.u")), 0)
+
     def test_find_nodes_regex(self):
         code = """
         module m(input logic a, input logic b, output logic x, output logic y);
@@ -206,6 +447,63 @@ class TestNetlistGraph(unittest.TestCase):
         none = test.graph.find_nodes_regex(r"z\..*")
         self.assertEqual(len(none), 0)
 
+    def test_freeze(self):
+        code = """
+        module m(input logic a, output logic x, output logic y);
+            assign x = a;
+            assign y = a;
+        endmodule
+        """
+        test = NetlistGraphTest(code)
+        start = test.graph.lookup("m.a")
+        before = [n.ID for n in test.graph.get_comb_fan_out(start)]
+        self.assertFalse(test.graph.is_frozen())
+        test.graph.freeze()
+        self.assertTrue(test.graph.is_frozen())
+        test.graph.build_indexes()
+        after = [n.ID for n in test.graph.get_comb_fan_out(start)]
+        self.assertEqual(before, after)
+        self.assertEqual(test.graph.lookup("m.a").ID, start.ID)
+        test.graph.unfreeze()
+        self.assertFalse(test.graph.is_frozen())
+
+    def test_freeze_release_edges(self):
+        code = """
+        module m(input logic a, output logic x, output logic y);
+            assign x = a;
+            assign y = a;
+        endmodule
+        """
+        test = NetlistGraphTest(code)
+        start = test.graph.lookup("m.a")
+        before = [n.ID for n in test.graph.get_comb_fan_out(start)]
+        num_edges = test.graph.num_edges()
+        test.graph.freeze(release_edges=True)
+        self.assertTrue(test.graph.has_released_edges())
+        self.assertEqual(test.graph.num_edges(), num_edges)
+        after = [n.ID for n in test.graph.get_comb_fan_out(start)]
+        self.assertEqual(before, after)
+        test.graph.unfreeze()
+        self.assertFalse(test.graph.has_released_edges())
+        self.assertEqual(test.graph.num_edges(), num_edges)
+
+    def test_contract_pass_through_nodes(self):
+        code = """
+        module m(input logic a, output logic x, output logic y);
+            assign x = a;
+            assign y = a;
+        endmodule
+        """
+        test = NetlistGraphTest(code)
+        num_nodes = test.graph.num_nodes()
+        removed = test.graph.contract_pass_through_nodes()
+        self.assertGreater(removed, 0)
+        self.assertEqual(test.graph.num_nodes(), num_nodes - removed)
+        start = test.graph.lookup("m.a")
+        fan_out = {n.ID for n in test.graph.get_comb_fan_out(start)}
+        self.assertIn(test.graph.lookup("m.x").ID, fan_out)
+        self.assertIn(test.graph.lookup("m.y").ID, fan_out)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -1,6 +1,7 @@
 import contextlib
 import json
 import os
+import re
 import subprocess
 import sys
 import tempfile
@@ -21,6 +22,13 @@ module m(input logic a, input logic b, output logic y);
 endmodule
 """
 
+BUS_SV = """\
+module m(input logic [7:0] a, output logic [3:0] x, output logic [3:0] y);
+  assign x = a[3:0];
+  assign y = a[7:4];
+endmodule
+"""
+
 SENS_SV = """\
 module m(input logic clk, input logic rst_n,
          input logic d, output logic q);
@@ -64,6 +72,17 @@ module m(input logic [3:0] a, input logic [3:0] b, output logic [3:0] y);
 endmodule
 """
 
+# Two elementary loops, a -> b -> a and a -> c -> a, in one strongly
+# connected component.
+TWO_LOOPS_SV = """\
+module m(input logic s);
+  wire a, b, c;
+  assign a = b | c;
+  assign b = a;
+  assign c = a & s;
+endmodule
+"""
+
 # Two instances of the same submodule (cpu and cpu2) so scope-boundary tests
 # can distinguish top.cpu from top.cpu2.
 FILTER_SV = """\
@@ -148,6 +167,35 @@ class DriverTests(unittest.TestCase):
         self.assertIn("rca.sum_q", r.stdout)
         self.assertIn("rca.o_sum", r.stdout)
 
+    def test_rca_path_search(self):
+        for mode in ("dfs", "shortest", "bidirectional"):
+            r = self.run_tool(
+                "rca.sv",
+                "--from",
+                "rca.i_op0",
+                "--to",
+                "rca.o_sum",
+                "--path-search",
+                mode,
+                "--no-colours",
+            )
+            self.assertIn("note: input port i_op0", r.stdout)
+            self.assertIn("note: output port o_sum", r.stdout)
+        self.assert_fails(
+            "rca.sv", "--from", "rca.i_op0", "--to", "rca.o_sum", "--path-search", "x"
+        )
+
+    def test_rca_max_paths(self):
+        args = ("rca.sv", "--from", "rca.i_op0", "--to", "rca.o_sum", "--no-colours")
+        r = self.run_tool(*args, "--max-paths", "2")
+        self.assertEqual(r.stdout.count("note: input port i_op0"), 2)
+        self.assert_fails(*args, "--max-paths", "2", "--max-path-depth", "1")
+        # The limits only apply to --max-paths, so they are rejected without it.
+        for option in ("--max-path-depth", "--path-time-limit"):
+            r = self.run_tool(*args, option, "100", check=False)
+            self.assertNotEqual(r.returncode, 0)
+            self.assertIn("requires --max-paths", r.stderr)
+
     def test_rca_registers(self):
         r = self.run_tool("rca.sv", "--report-registers")
         self.assertTrue(
@@ -161,6 +209,17 @@ rca.co_q   rca.sv:13:23
             )
         )
 
+    def test_rca_logic_depth(self):
+        r = self.run_tool("rca.sv", "--logic-depth", "1", "--no-colours")
+        headers = re.findall(r"Logic depth (\d+): (\S+)", r.stdout)
+        self.assertEqual(len(headers), 1)
+        self.assertIn(headers[0][1], ("rca.sum_q", "rca.co_q"))
+        self.assertGreater(int(headers[0][0]), 1)
+        r = self.run_tool("rca.sv", "--logic-depth", "0", "--no-colours")
+        depths = [int(d) for d in re.findall(r"Logic depth (\d+):", r.stdout)]
+        self.assertGreater(len(depths), 2)
+        self.assertEqual(depths, sorted(depths, reverse=True))
+
     def test_comb_loop(self):
         r = self.run_tool("comb-loop.sv", "--comb-loops", "--no-colours")
         self.assertTrue(
@@ -194,6 +253,19 @@ comb-loop.sv:10:10: note: assignment
             )
         )
 
+    def test_comb_loops_limit(self):
+        path = self._write_sv(TWO_LOOPS_SV)
+        r = self.run_tool(path, "--comb-loops", "--no-colours")
+        self.assertGreater(r.stdout.count("Combinational loop detected:"), 1)
+        self.assertNotIn("--comb-loops-limit 0", r.stdout)
+        r = self.run_tool(
+            path, "--comb-loops", "--comb-loops-limit", "1", "--no-colours"
+        )
+        self.assertEqual(r.stdout.count("Combinational loop detected:"), 1)
+        self.assertIn(
+            "Note: listed only the first 1 loop(s) of 1 component(s)", r.stdout
+        )
+
     def test_no_comb_loop(self):
         r = self.run_tool("rca.sv", "--comb-loops", "--no-colours")
         self.assertIn("No combinational loops detected in the design.", r.stdout)
@@ -245,6 +317,14 @@ comb-loop.sv:10:10: note: assignment
         # Register output should still be present.
         self.assertIn("rca.sum_q", r.stdout)
 
+    def test_stats_json_arena(self):
+        r = self.run_tool("rca.sv", "--report-registers", "--stats-json")
+        stats = self._parse_stats(r.stdout)
+        arena = stats["arena"]
+        self.assertGreater(arena["allocations"], 0)
+        self.assertGreaterEqual(arena["bytes_reserved"], arena["bytes_used"])
+        self.assertGreaterEqual(arena["estimated_bytes_saved"], 0)
+
     def test_stats_json_not_present_without_flag(self):
         """Stats JSON is not emitted when --stats-json is not specified."""
         r = self.run_tool("rca.sv", "--report-registers")
@@ -276,6 +356,19 @@ comb-loop.sv:10:10: note: assignment
         self.assertIn("m.a", r.stdout)
         self.assertIn("m.b", r.stdout)
 
+    def test_fan_bits(self):
+        r = self.run_tool("--fan-out", "m.a[5]", source=BUS_SV)
+        self.assertIn("m.y", r.stdout)
+        self.assertNotIn("m.x", r.stdout)
+        self.assertIn("[5]", r.stdout)
+        r = self.run_tool("--fan-in", "m.x[1:0]", source=BUS_SV)
+        self.assertIn("m.a", r.stdout)
+        self.assertIn("[3:0]", r.stdout)
+        path = self._write_sv(BUS_SV)
+        r = self.run_tool(path, "--from", "m.a[6]", "--to", "m.y", "--no-colours")
+        self.assertIn("m.a[7:4]", r.stdout)
+        self.assert_fails(path, "--from", "m.a[6]", "--to", "m.x")
+
     def test_fan_out_nonexistent(self):
         self.assert_fails("rca.sv", "--fan-out", "rca.nonexistent")
 
@@ -437,6 +530,70 @@ comb-loop.sv:10:10: note: assignment
     def test_drivers_nonexistent(self):
         self.assert_fails("rca.sv", "--drivers", "rca.nonexistent")
 
+    def test_queries(self):
+        queries = """\
+# Comments and blank lines are skipped.
+fan-out m.a
+
+--fan-in m.y
+path m.a m.x
+fan-out m.nonexistent
+bogus m.a
+"""
+        with self.temp_path(".txt") as path:
+            with open(path, "w") as f:
+                f.write(queries)
+            r = self.run_tool("--queries", path, source=FANOUT_SV)
+        results = [json.loads(line) for line in r.stdout.splitlines()]
+        self.assertEqual([result["line"] for result in results], [2, 4, 5, 6, 7])
+        self.assertEqual(results[0]["query"], "fan-out m.a")
+        names = {entry["name"] for entry in results[0]["results"]}
+        self.assertTrue({"m.x", "m.y"} <= names)
+        names = {entry["name"] for entry in results[1]["results"]}
+        self.assertIn("m.a", names)
+        nodes = [entry["node"] for entry in results[2]["results"]]
+        self.assertEqual(nodes[0], "input port m.a")
+        self.assertEqual(nodes[-1], "output port m.x")
+        self.assertIn("could not find node", results[3]["error"])
+        self.assertIn("unknown query", results[4]["error"])
+
+    def test_queries_parallel(self):
+        # More queries than one batch task takes, so that they run on the
+        # thread pool; the output is in file order and matches a serial run.
+        kinds = ["fan-out m.a", "path m.a m.y", "find-regex m\\.[xy]", "fan-in m.x"]
+        queries = [kinds[i % len(kinds)] for i in range(64)]
+        sv = self._write_sv(FANOUT_SV)
+        with self.temp_path(".txt") as path:
+            with open(path, "w") as f:
+                f.write("\n".join(queries) + "\n")
+            parallel = self.run_tool(sv, "--queries", path, "--threads", "4")
+            serial = self.run_tool(sv, "--queries", path, "--threads", "1")
+        results = [json.loads(line) for line in parallel.stdout.splitlines()]
+        self.assertEqual([result["line"] for result in results], list(range(1, 65)))
+        self.assertEqual([result["query"] for result in results], queries)
+        for result in results:
+            self.assertNotIn("error", result)
+            self.assertTrue(result["results"])
+        self.assertEqual(parallel.stdout, serial.stdout)
+
+    def test_queries_rejects_other_actions(self):
+        sv = self._write_sv(FANOUT_SV)
+        with self.temp_path(".txt") as path:
+            with open(path, "w") as f:
+                f.write("fan-out m.a\n")
+            for option in (
+                ("--fan-out", "m.a"),
+                ("--from", "m.a", "--to", "m.x"),
+                ("--find-regex", "m\\..*"),
+                ("--report-registers",),
+                ("--comb-loops",),
+                ("--logic-depth", "1"),
+            ):
+                with self.subTest(option=option):
+                    r = self.run_tool(sv, "--queries", path, *option, check=False)
+                    self.assertNotEqual(r.returncode, 0)
+                    self.assertIn("cannot be combined with", r.stderr)
+
     def test_netlist_dot_full(self):
         # Without a scope selector the whole graph is rendered.
         r = self.run_tool("--netlist-dot", "-", source=DOT_SCOPE_SV)
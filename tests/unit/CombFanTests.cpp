@@ -1,8 +1,12 @@
 #include "Test.hpp"
+#include "netlist/ConstantDriverMap.hpp"
 
 #include <algorithm>
 #include <set>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace {
 
@@ -116,3 +120,190 @@ TEST_CASE("Fan-in from a single node", "[CombFan]") {
   CHECK(fanIn.size() == 1);
   CHECK(fanIn[0] == start);
 }
+
+TEST_CASE("Bit-precise fan-out and fan-in of a bus", "[CombFan]") {
+  auto const &tree = R"(
+  module inner(input logic [3:0] p, output logic [1:0] o);
+    assign o = p[1:0];
+  endmodule
+  module m(input logic [7:0] bus, output logic [3:0] lo,
+           output logic [3:0] hi, output logic [1:0] y);
+    assign lo = bus[3:0];
+    assign hi = bus[7:4];
+    inner u(.p(bus[7:4]), .o(y));
+  endmodule
+  )";
+  const NetlistTest test(tree);
+  auto *bus = test.graph.lookup("m.bus");
+  REQUIRE(bus);
+  auto bitsOf = [](std::vector<NetlistGraph::BitNode> const &cone,
+                   std::string_view name) {
+    std::vector<std::pair<int32_t, int32_t>> bits;
+    for (auto const &n : cone) {
+      if (n.node->getHierarchicalPath() == name) {
+        for (auto const &range : n.bits) {
+          bits.emplace_back(range.lower(), range.upper());
+        }
+      }
+    }
+    return bits;
+  };
+  using Bits = std::vector<std::pair<int32_t, int32_t>>;
+
+  // The whole-node cone reaches every reader of the bus.
+  auto names = getNames(test.graph.getCombFanOut(*bus));
+  CHECK(names.contains("m.lo"));
+  CHECK(names.contains("m.hi"));
+
+  // One bit reaches only the logic reading it, and is remapped into the
+  // bit space of the instance port it is connected to.
+  auto cone = test.graph.getCombFanOut(*bus, DriverBitRange{5, 5});
+  CHECK(bitsOf(cone, "m.bus") == Bits{{5, 5}});
+  CHECK(!bitsOf(cone, "m.hi").empty());
+  CHECK(bitsOf(cone, "m.lo").empty());
+  CHECK(bitsOf(cone, "m.u.p") == Bits{{1, 1}});
+  CHECK(!bitsOf(cone, "m.u.o").empty());
+
+  // Bit 6 enters the instance as p[2], which o does not read.
+  cone = test.graph.getCombFanOut(*bus, DriverBitRange{6, 6});
+  CHECK(bitsOf(cone, "m.u.p") == Bits{{2, 2}});
+  CHECK(bitsOf(cone, "m.u.o").empty());
+
+  // Bits outside the node reach nothing.
+  CHECK(test.graph.getCombFanOut(*bus, DriverBitRange{9, 8}).empty());
+
+  // An assignment passes on every bit it reads, so the fan-in of one bit
+  // of lo is the whole slice of the bus it is assigned from.
+  auto *lo = test.graph.lookup("m.lo");
+  REQUIRE(lo);
+  auto fanIn = test.graph.getCombFanIn(*lo, DriverBitRange{1, 1});
+  CHECK(bitsOf(fanIn, "m.bus") == Bits{{0, 3}});
+}
+
+TEST_CASE("Fan queries sharing a traversal context", "[CombFan]") {
+  auto const &tree = R"(
+  module m(input clk, input logic a, input logic b, output logic x,
+           output logic y);
+    logic q;
+    always_ff @(posedge clk)
+      q <= a;
+    assign x = a & b;
+    assign y = q | b;
+  endmodule
+  )";
+  NetlistTest test(tree);
+  auto check = [&] {
+    TraversalContext context;
+    for (auto const *name : {"m.a", "m.b", "m.x", "m.y"}) {
+      auto *node = test.graph.lookup(name);
+      REQUIRE(node);
+      CHECK(test.graph.getCombFanOut(*node, context) ==
+            test.graph.getCombFanOut(*node));
+      CHECK(test.graph.getCombFanIn(*node, context) ==
+            test.graph.getCombFanIn(*node));
+      CHECK(test.graph.getSensitivity(*node, context) ==
+            test.graph.getSensitivity(*node));
+    }
+  };
+  check();
+  test.graph.freeze();
+  check();
+}
+
+TEST_CASE("Batched fan queries agree with one query per source",
+          "[CombFan]") {
+  // A combinational loop through t, sequential state, and more sources than
+  // one sweep handles, with repeats.
+  auto const &tree = R"(
+  module t(input x, output y);
+    assign y = x;
+  endmodule
+
+  module m(input clk, input logic a, input logic b, output logic x,
+           output logic y);
+    wire c, d;
+    logic q;
+    t t(.x(c), .y(d));
+    assign c = d | a;
+    always_ff @(posedge clk)
+      q <= c;
+    assign x = d & b;
+    assign y = q | b;
+  endmodule
+  )";
+  NetlistTest test(tree);
+  std::vector<NetlistNode *> sources;
+  while (sources.size() <= 300) {
+    for (auto const &node : test.graph) {
+      sources.push_back(node.get());
+    }
+  }
+  auto byIndex = [](std::vector<NetlistNode *> nodes) {
+    std::ranges::sort(nodes, {}, &NetlistNode::getGraphIndex);
+    return nodes;
+  };
+  auto check = [&] {
+    auto fanOuts = test.graph.getCombFanOutMany(sources);
+    auto fanIns = test.graph.getCombFanInMany(sources);
+    auto fanOutCounts = test.graph.getCombFanOutCounts(sources);
+    auto fanInCounts = test.graph.getCombFanInCounts(sources);
+    REQUIRE(fanOuts.size() == sources.size());
+    REQUIRE(fanIns.size() == sources.size());
+    for (size_t i = 0; i < sources.size(); i++) {
+      auto fanOut = byIndex(test.graph.getCombFanOut(*sources[i]));
+      auto fanIn = byIndex(test.graph.getCombFanIn(*sources[i]));
+      CHECK(fanOuts[i] == fanOut);
+      CHECK(fanIns[i] == fanIn);
+      CHECK(fanOutCounts[i] == fanOut.size());
+      CHECK(fanInCounts[i] == fanIn.size());
+    }
+  };
+  check();
+  test.graph.freeze();
+  check();
+  CHECK(test.graph.getCombFanOutMany({}).empty());
+}
+
+TEST_CASE("Constant drivers of tied-off, input and register cones",
+          "[CombFan]") {
+  auto const &tree = R"(
+  module m(input clk, input logic a, output logic y_tied,
+           output logic y_real, output logic y_reg, output logic y_chain);
+    logic q, w;
+    always_ff @(posedge clk)
+      q <= a;
+    assign w = 1'b0;
+    assign y_tied = 1'b1;
+    assign y_real = a & 1'b1;
+    assign y_reg = q | 1'b0;
+    assign y_chain = w;
+  endmodule
+  )";
+  const NetlistTest test(tree);
+  ConstantDriverMap const map(test.graph);
+  TraversalContext context;
+  for (auto const &node : test.graph) {
+    auto expected = test.graph.getConstantDrivers(*node);
+    auto actual = map.getConstantDrivers(*node);
+    CHECK(std::set<NetlistNode *>(expected.begin(), expected.end()) ==
+          std::set<NetlistNode *>(actual.begin(), actual.end()));
+    CHECK(test.graph.getConstantDrivers(*node, context) == expected);
+  }
+
+  using DriveKind = ConstantDriverMap::DriveKind;
+  auto kindOf = [&](std::string_view name) {
+    auto *node = test.graph.lookup(name);
+    REQUIRE(node);
+    return map.getDriveKind(*node);
+  };
+  CHECK(kindOf("m.y_tied") == DriveKind::Constant);
+  CHECK(kindOf("m.y_chain") == DriveKind::Constant);
+  CHECK(kindOf("m.y_real") == DriveKind::External);
+  CHECK(kindOf("m.y_reg") == DriveKind::State);
+
+  // A register in the fan-in is not a tie-off, even alongside a constant.
+  auto *reg = test.graph.lookup("m.y_reg");
+  REQUIRE(reg);
+  CHECK(test.graph.getConstantDrivers(*reg).empty());
+  CHECK(map.getConstants(*reg).size() == 1);
+}
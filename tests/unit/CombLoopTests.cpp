@@ -153,3 +153,34 @@ endmodule
   auto cycles = combLoops.getAllLoops();
   CHECK(cycles.empty());
 }
+
+TEST_CASE("Loops sharing nodes are enumerated per component", "[CombLoop]") {
+  // Two loops through a, one via b and one via c, in one component.
+  auto const &tree = (R"(
+module m(input s);
+  wire a, b, c;
+  assign a = b | c;
+  assign b = a;
+  assign c = a & s;
+endmodule
+)");
+  const NetlistTest test(tree);
+  CombLoops combLoops(test.graph);
+  auto components = combLoops.getLoopComponents();
+  REQUIRE(components.size() == 1);
+  auto cycles = combLoops.getAllLoops();
+  CHECK(cycles.size() == 2);
+  for (auto const &cycle : cycles) {
+    // Each loop starts at its lowest ID and lies within the component.
+    CHECK(std::ranges::min(cycle, {}, &NetlistNode::ID) == cycle.front());
+    for (auto const *node : cycle) {
+      CHECK(std::ranges::find(components[0], node) != components[0].end());
+    }
+  }
+  std::vector<std::vector<const NetlistNode *>> truncated;
+  CHECK(combLoops.getAllLoops(1, &truncated).size() == 1);
+  REQUIRE(truncated.size() == 1);
+  CHECK(truncated[0] == components[0]);
+  CHECK(combLoops.getAllLoops(2, &truncated).size() == 2);
+  CHECK(truncated.empty());
+}
@@ -233,3 +233,110 @@ TEST_CASE("Backward DFS with edge predicate", "[DepthFirstSearch]") {
   CHECK(visitor.nodes.size() == 1);
   CHECK(*visitor.nodes[0] == n2);
 }
+
+TEST_CASE("DFS on a long chain is iterative", "[DepthFirstSearch]") {
+  // Deep enough to overflow the call stack if each level recursed.
+  const size_t length = 200000;
+  DirectedGraph<TestNode, TestEdge> graph;
+  std::vector<TestNode *> nodes;
+  nodes.reserve(length);
+  for (size_t i = 0; i < length; ++i) {
+    nodes.push_back(&graph.addNode(std::make_unique<TestNode>(i)));
+    if (i > 0) {
+      graph.addEdge(*nodes[i - 1], *nodes[i]);
+    }
+  }
+  TestVisitor visitor;
+  const DepthFirstSearch<TestNode, TestEdge, TestVisitor> dfs(visitor,
+                                                              *nodes[0]);
+  REQUIRE(visitor.nodes.size() == length);
+  CHECK(visitor.nodes.back() == nodes.back());
+  CHECK(visitor.edges.size() == length - 1);
+}
+
+TEST_CASE("DFS reuses a traversal context across searches",
+          "[DepthFirstSearch]") {
+  // n0 -> n1 -> n2, n3 -> n2
+  DirectedGraph<TestNode, TestEdge> graph;
+  auto &n0 = graph.addNode(std::make_unique<TestNode>(0));
+  auto &n1 = graph.addNode(std::make_unique<TestNode>(1));
+  auto &n2 = graph.addNode(std::make_unique<TestNode>(2));
+  auto &n3 = graph.addNode(std::make_unique<TestNode>(3));
+  graph.addEdge(n0, n1);
+  graph.addEdge(n1, n2);
+  graph.addEdge(n3, n2);
+
+  TraversalContext context;
+  TestVisitor first;
+  DepthFirstSearch<TestNode, TestEdge, TestVisitor> dfs1(context, first, n0);
+  CHECK(first.nodes.size() == 3);
+  auto capacity = context.capacity();
+  CHECK(capacity >= 3);
+
+  // Nodes visited by the first search are not treated as visited by the
+  // second.
+  TestVisitor second;
+  DepthFirstSearch<TestNode, TestEdge, TestVisitor> dfs2(context, second, n3);
+  CHECK(second.nodes.size() == 2);
+  CHECK(context.isVisited(n2.getGraphIndex()));
+  CHECK_FALSE(context.isVisited(n0.getGraphIndex()));
+
+  TestVisitor backward;
+  DepthFirstSearch<TestNode, TestEdge, TestVisitor, select_all,
+                   Direction::Backward>
+      dfs3(context, backward, n2);
+  CHECK(backward.nodes.size() == 4);
+  CHECK(context.capacity() == capacity);
+}
+
+TEST_CASE("DFS after removing nodes", "[DepthFirstSearch]") {
+  // n0 -> n1 -> n2 -> n3 -> n4, then remove n1 and link n0 -> n2 so that
+  // the remaining nodes are renumbered.
+  DirectedGraph<TestNode, TestEdge> graph;
+  std::vector<TestNode *> nodes;
+  for (size_t i = 0; i < 5; ++i) {
+    nodes.push_back(&graph.addNode(std::make_unique<TestNode>(i)));
+  }
+  for (size_t i = 0; i + 1 < 5; ++i) {
+    graph.addEdge(*nodes[i], *nodes[i + 1]);
+  }
+  TraversalContext context;
+  TestVisitor before;
+  DepthFirstSearch<TestNode, TestEdge, TestVisitor> dfs1(context, before,
+                                                         *nodes[0]);
+  CHECK(before.nodes.size() == 5);
+
+  graph.removeNode(*nodes[1]);
+  graph.addEdge(*nodes[0], *nodes[2]);
+  TestVisitor after;
+  DepthFirstSearch<TestNode, TestEdge, TestVisitor> dfs2(context, after,
+                                                         *nodes[0]);
+  CHECK(after.nodes.size() == 4);
+  CHECK(after.nodes.back() == nodes[4]);
+}
+
+TEST_CASE("Traversal context epochs", "[DepthFirstSearch]") {
+  TraversalContext context;
+  context.reset(4);
+  CHECK(context.capacity() == 4);
+  CHECK_FALSE(context.isVisited(1));
+  CHECK(context.markVisited(1));
+  CHECK_FALSE(context.markVisited(1));
+  CHECK(context.isVisited(1));
+  // Indices beyond the hint grow the array.
+  CHECK(context.markVisited(10));
+  CHECK(context.capacity() > 10);
+  context.reset();
+  CHECK_FALSE(context.isVisited(1));
+  CHECK_FALSE(context.isVisited(10));
+}
+
+TEST_CASE("DFS rejects a start node that is not in a graph",
+          "[DepthFirstSearch]") {
+  TestNode node(0);
+  TestVisitor visitor;
+  CHECK_THROWS_AS((DepthFirstSearch<TestNode, TestEdge, TestVisitor>(visitor,
+                                                                     node)),
+                  std::invalid_argument);
+  CHECK(visitor.nodes.empty());
+}
@@ -362,3 +362,94 @@ TEST_CASE("High fan-out addEdge stays linear", "[DirectedGraph]") {
   }
   CHECK(source.outDegree() == kFanOut);
 }
+
+TEST_CASE("Nodes and edges are allocated in the graph arenas",
+          "[DirectedGraph]") {
+  GraphType graph;
+  auto &n0 = graph.addNode();
+  auto &n1 = graph.emplaceNode<TestNode>();
+  n0.addEdge(n1);
+  n1.addEdge(n0);
+  n0.addNewEdge(n1);
+  auto stats = graph.getArenaStats();
+  CHECK(stats.allocations == 5);
+  // One slab for the nodes and one for the edges.
+  CHECK(stats.slabs == 2);
+  CHECK(graph.getEdgeArenaStats().allocations == 3);
+  CHECK(stats.bytesUsed >= 2 * sizeof(TestNode) + 3 * sizeof(TestEdge));
+  CHECK(stats.bytesReserved >= stats.bytesUsed);
+  // Removing arena-allocated nodes and edges only destroys them.
+  CHECK(graph.removeEdge(n1, n0));
+  CHECK(graph.removeNode(n0));
+  CHECK(graph.numNodes() == 1);
+  CHECK(graph.numEdges() == 0);
+  CHECK(graph.getArenaStats().allocations == 5);
+}
+
+TEST_CASE("Heap-allocated nodes use the graph arena for edges",
+          "[DirectedGraph]") {
+  GraphType graph;
+  auto &n0 = graph.addNode(std::make_unique<TestNode>());
+  auto &n1 = graph.addNode(std::make_unique<TestNode>());
+  graph.addEdge(n0, n1);
+  CHECK(graph.getArenaStats().allocations == 1);
+  CHECK(graph.removeNode(n1));
+  CHECK(n0.outDegree() == 0);
+}
+
+TEST_CASE("Node graph indices track removal", "[DirectedGraph]") {
+  GraphType graph;
+  std::vector<TestNode *> nodes;
+  for (size_t i = 0; i < 5; ++i) {
+    nodes.push_back(&graph.addNode());
+    CHECK(nodes.back()->getGraphIndex() == i);
+    CHECK(graph.findNode(*nodes.back()) == i);
+  }
+  CHECK(graph.removeNode(*nodes[1]));
+  CHECK(graph.findNode(*nodes[0]) == 0);
+  CHECK(graph.findNode(*nodes[2]) == 1);
+  CHECK(graph.findNode(*nodes[4]) == 3);
+  for (size_t i = 0; i < graph.numNodes(); ++i) {
+    CHECK(graph.getNode(i).getGraphIndex() == i);
+  }
+  // A node from another graph is not found, even at a valid index.
+  GraphType other;
+  auto &foreign = other.addNode();
+  CHECK(graph.findNode(foreign) == GraphType::null_node);
+}
+
+TEST_CASE("Remove many nodes in one pass", "[DirectedGraph]") {
+  GraphType graph;
+  std::vector<TestNode *> nodes;
+  for (size_t i = 0; i < 8; ++i) {
+    nodes.push_back(&graph.addNode());
+  }
+  // A chain 0 -> 1 -> ... -> 7 plus an edge between two removed nodes.
+  for (size_t i = 0; i + 1 < nodes.size(); ++i) {
+    graph.addEdge(*nodes[i], *nodes[i + 1]);
+  }
+  graph.addEdge(*nodes[1], *nodes[5]);
+
+  auto *n0 = nodes[0];
+  auto *n2 = nodes[2];
+  auto *n4 = nodes[4];
+  auto *n6 = nodes[6];
+  auto *n7 = nodes[7];
+  TestNode outside;
+  std::vector<TestNode *> toRemove = {nodes[5], nodes[1], nodes[3], nodes[1],
+                                      &outside};
+  CHECK(graph.removeNodes(toRemove) == 3);
+  CHECK(graph.numNodes() == 5);
+  CHECK(graph.numEdges() == 1); // Only 6 -> 7 survives.
+
+  // The remaining nodes keep their relative order and dense indices.
+  std::vector<TestNode *> expected = {n0, n2, n4, n6, n7};
+  for (size_t i = 0; i < expected.size(); ++i) {
+    CHECK(&graph.getNode(i) == expected[i]);
+    CHECK(graph.findNode(*expected[i]) == i);
+  }
+  CHECK(n2->inDegree() == 0);
+  CHECK(n4->outDegree() == 0);
+  CHECK(n6->outDegree() == 1);
+  CHECK(graph.removeNodes(std::vector<TestNode *>{}) == 0);
+}
@@ -0,0 +1,378 @@
+#include "Test.hpp"
+
+#include "netlist/DriverIndex.hpp"
+#include "netlist/FrozenNetlist.hpp"
+
+TEST_CASE("Frozen snapshot mirrors the graph structure", "[Frozen]") {
+  auto const &tree = R"(
+  module m(input clk, input logic a, input logic b, output logic y);
+    logic q;
+    always_ff @(posedge clk)
+      q <= a;
+    assign y = q + b;
+  endmodule
+  )";
+  NetlistTest test(tree);
+  CHECK_FALSE(test.graph.isFrozen());
+  test.graph.freeze();
+  REQUIRE(test.graph.isFrozen());
+  auto const &frozen = *test.graph.getFrozen();
+  CHECK(frozen.numNodes() == test.graph.numNodes());
+  CHECK(frozen.numEdges() == test.graph.numEdges());
+
+  FrozenNetlist::NodeIndex index = 0;
+  for (auto const &node : test.graph) {
+    REQUIRE(frozen.getIndex(*node) == index);
+    CHECK(&frozen.getNode(index) == node.get());
+    CHECK(frozen.getKind(index) == node->kind);
+    CHECK(frozen.outDegree(index) == node->outDegree());
+    CHECK(frozen.inDegree(index) == node->inDegree());
+
+    // Out-edges follow the node's outEdges order.
+    size_t i = 0;
+    for (auto edge : frozen.outEdges(index)) {
+      auto const &orig = *node->getOutEdges()[i++];
+      CHECK(frozen.getSource(edge) == index);
+      CHECK(&frozen.getNode(frozen.getTarget(edge)) == &orig.getTargetNode());
+      CHECK(frozen.getEdgeKind(edge) == orig.edgeKind);
+      CHECK(frozen.isDisabled(edge) == orig.disabled);
+      CHECK(frozen.getSymbol(edge) == orig.symbol);
+    }
+
+    // In-edges follow the node's inEdges order.
+    i = 0;
+    for (auto edge : frozen.inEdges(index)) {
+      auto const &orig = *node->getInEdges()[i++];
+      CHECK(&frozen.getNode(frozen.getSource(edge)) == &orig.getSourceNode());
+      CHECK(frozen.getTarget(edge) == index);
+      CHECK(frozen.getSymbol(edge) == orig.symbol);
+    }
+    index++;
+  }
+}
+
+TEST_CASE("Frozen queries match unfrozen queries", "[Frozen]") {
+  auto const &tree = R"(
+  module m(input clk, input rst, input logic [3:0] a, input logic [3:0] b,
+           output logic [3:0] x, output logic [3:0] y);
+    logic [3:0] q;
+    always_ff @(posedge clk or negedge rst)
+      if (!rst) q <= 0;
+      else q <= a ^ b;
+    assign x = q | a;
+    assign y = {a[1:0], b[3:2]};
+  endmodule
+  )";
+  NetlistTest test(tree);
+
+  std::vector<std::vector<NetlistNode *>> fanOut;
+  std::vector<std::vector<NetlistNode *>> fanIn;
+  std::vector<std::vector<NetlistGraph::SensitivitySource>> sensitivity;
+  for (auto const &node : test.graph) {
+    fanOut.push_back(test.graph.getCombFanOut(*node));
+    fanIn.push_back(test.graph.getCombFanIn(*node));
+    sensitivity.push_back(test.graph.getSensitivity(*node));
+  }
+  auto drivers = test.graph.getDrivers("m.y", DriverBitRange{3, 0});
+  auto bitDrivers = test.graph.getBitDrivers("m.y");
+
+  test.graph.freeze();
+  size_t i = 0;
+  for (auto const &node : test.graph) {
+    CHECK(test.graph.getCombFanOut(*node) == fanOut[i]);
+    CHECK(test.graph.getCombFanIn(*node) == fanIn[i]);
+    CHECK(test.graph.getSensitivity(*node) == sensitivity[i]);
+    i++;
+  }
+  CHECK(test.graph.getDrivers("m.y", DriverBitRange{3, 0}) == drivers);
+  auto frozenBitDrivers = test.graph.getBitDrivers("m.y");
+  REQUIRE(frozenBitDrivers.size() == bitDrivers.size());
+  for (size_t j = 0; j < bitDrivers.size(); j++) {
+    CHECK(frozenBitDrivers[j].driver == bitDrivers[j].driver);
+    CHECK(frozenBitDrivers[j].bounds == bitDrivers[j].bounds);
+  }
+}
+
+TEST_CASE("Adding an edge drops the frozen snapshot", "[Frozen]") {
+  auto const &tree = R"(
+  module m(input logic a, output logic x, output logic y);
+    assign x = a;
+  endmodule
+  )";
+  NetlistTest test(tree);
+  test.graph.freeze();
+  auto *a = test.graph.lookup("m.a");
+  auto *y = test.graph.lookup("m.y");
+  REQUIRE(a);
+  REQUIRE(y);
+  test.graph.addEdge(*a, *y);
+  CHECK_FALSE(test.graph.isFrozen());
+  auto fanOut = test.graph.getCombFanOut(*a);
+  CHECK(std::ranges::find(fanOut, y) != fanOut.end());
+  test.graph.freeze();
+  CHECK(test.graph.getCombFanOut(*a) == fanOut);
+  test.graph.unfreeze();
+  CHECK_FALSE(test.graph.isFrozen());
+}
+
+TEST_CASE("Packed edges preserve edge attributes", "[Frozen]") {
+  // Bounds beyond 16 bits are stored out of line.
+  auto const &tree = R"(
+  module m(input clk, input logic [69999:0] a, input logic [3:0] b,
+           output logic [69999:0] x, output logic [3:0] y);
+    logic [3:0] q;
+    always_ff @(posedge clk)
+      q <= b;
+    assign x = a;
+    assign y = q;
+  endmodule
+  )";
+  NetlistTest test(tree);
+  STATIC_REQUIRE(sizeof(FrozenNetlist::PackedEdge) == 16);
+  test.graph.freeze();
+  auto const &frozen = *test.graph.getFrozen();
+  bool sawWide = false;
+  bool sawClock = false;
+  for (auto const &node : test.graph) {
+    size_t i = 0;
+    for (auto e : frozen.outEdges(frozen.getIndex(*node))) {
+      auto const &edge = *node->getOutEdges()[i++];
+      CHECK(frozen.getSymbol(e) == edge.symbol);
+      CHECK(frozen.getBounds(e).left == edge.bounds.left);
+      CHECK(frozen.getBounds(e).right == edge.bounds.right);
+      CHECK(frozen.getEdgeKind(e) == edge.edgeKind);
+      CHECK(frozen.isDisabled(e) == edge.disabled);
+      sawWide |= edge.bounds.upper() > 0xffff;
+      sawClock |= edge.edgeKind == ast::EdgeKind::PosEdge;
+    }
+  }
+  CHECK(sawWide);
+  CHECK(sawClock);
+  CHECK(frozen.memoryBytes() > 0);
+}
+
+TEST_CASE("Packed edges track the disabled flag", "[Frozen]") {
+  auto const &tree = R"(
+  module m(input logic a, output logic x);
+    assign x = a;
+  endmodule
+  )";
+  NetlistTest test(tree);
+  auto *a = test.graph.lookup("m.a");
+  REQUIRE(a != nullptr);
+  REQUIRE_FALSE(a->getOutEdges().empty());
+  a->getOutEdges().front()->disable();
+  test.graph.freeze();
+  auto const &frozen = *test.graph.getFrozen();
+  auto index = frozen.getIndex(*a);
+  auto edges = frozen.outEdges(index);
+  REQUIRE_FALSE(edges.empty());
+  CHECK(frozen.isDisabled(*edges.begin()));
+  CHECK(&frozen.getNode(frozen.getTarget(*edges.begin())) ==
+        &a->getOutEdges().front()->getTargetNode());
+}
+
+TEST_CASE("Driver index answers bit-range queries like an edge scan",
+          "[Frozen]") {
+  auto const &tree = R"(
+  module m(input clk, input logic [7:0] a, input logic [7:0] b,
+           output logic [7:0] y, output logic [7:0] z);
+    logic [7:0] q;
+    always_ff @(posedge clk)
+      q[7:4] <= a[3:0];
+    always_ff @(posedge clk)
+      q[3:0] <= b[7:4];
+    assign y[1:0] = a[7:6];
+    assign y[7:2] = q[5:0] ^ b[5:0];
+    assign z = {q[3:0], a[7:4]};
+  endmodule
+  )";
+  NetlistTest test(tree);
+
+  struct Query {
+    std::string name;
+    DriverBitRange bounds;
+  };
+  std::vector<Query> queries;
+  for (auto const *name : {"m.a", "m.b", "m.q", "m.y", "m.z", "m.none"}) {
+    for (int32_t lower = 0; lower < 8; lower++) {
+      for (int32_t upper = lower; upper < 8; upper++) {
+        queries.push_back({name, DriverBitRange{upper, lower}});
+      }
+    }
+  }
+  std::vector<std::vector<NetlistNode *>> drivers;
+  std::vector<std::vector<NetlistGraph::BitDriver>> bitDrivers;
+  for (auto const &query : queries) {
+    drivers.push_back(test.graph.getDrivers(query.name, query.bounds));
+    bitDrivers.push_back(test.graph.getBitDrivers(query.name, query.bounds));
+  }
+
+  test.graph.freeze();
+  DriverIndex index(*test.graph.getFrozen());
+  CHECK(index.numSymbols() > 0);
+  CHECK(index.find("", DriverBitRange{7, 0}).empty());
+  for (size_t i = 0; i < queries.size(); i++) {
+    auto const &query = queries[i];
+    CHECK(test.graph.getDrivers(query.name, query.bounds) == drivers[i]);
+    auto frozenBitDrivers =
+        test.graph.getBitDrivers(query.name, query.bounds);
+    REQUIRE(frozenBitDrivers.size() == bitDrivers[i].size());
+    for (size_t j = 0; j < frozenBitDrivers.size(); j++) {
+      CHECK(frozenBitDrivers[j].driver == bitDrivers[i][j].driver);
+      CHECK(frozenBitDrivers[j].bounds == bitDrivers[i][j].bounds);
+    }
+  }
+  CHECK(test.graph.getDrivers("m.none", DriverBitRange{7, 0}).empty());
+}
+
+TEST_CASE("Releasing the edges keeps only the packed snapshot", "[Frozen]") {
+  auto const &tree = R"(
+  module m(input clk, input rst, input logic [3:0] a, input logic [3:0] b,
+           output logic [3:0] x, output logic [3:0] y, output logic [3:0] z);
+    logic [3:0] q;
+    always_ff @(posedge clk or negedge rst)
+      if (!rst) q <= 0;
+      else q <= a ^ b;
+    assign x = q | a;
+    assign y = {a[1:0], b[3:2]};
+    assign z = 4'd5;
+  endmodule
+  )";
+  NetlistTest test(tree);
+
+  // Record each node's edges and the query results before the release.
+  struct EdgeRecord {
+    NetlistNode const *target;
+    SymbolReference const *symbol;
+    DriverBitRange bounds;
+    ast::EdgeKind edgeKind;
+    bool disabled;
+  };
+  std::vector<std::vector<EdgeRecord>> outEdges;
+  std::vector<std::vector<NetlistNode const *>> inSources;
+  std::vector<std::vector<NetlistNode *>> fanOut;
+  std::vector<std::vector<NetlistNode *>> fanIn;
+  std::vector<std::vector<NetlistGraph::SensitivitySource>> sensitivity;
+  std::vector<std::vector<NetlistNode *>> constants;
+  std::vector<NetlistNode *> sources;
+  for (auto const &node : test.graph) {
+    auto &out = outEdges.emplace_back();
+    for (auto const &edge : node->getOutEdges()) {
+      out.push_back({&edge->getTargetNode(), edge->symbol, edge->bounds,
+                     edge->edgeKind, edge->disabled});
+    }
+    auto &in = inSources.emplace_back();
+    for (auto const *edge : node->getInEdges()) {
+      in.push_back(&edge->getSourceNode());
+    }
+    fanOut.push_back(test.graph.getCombFanOut(*node));
+    fanIn.push_back(test.graph.getCombFanIn(*node));
+    sensitivity.push_back(test.graph.getSensitivity(*node));
+    constants.push_back(test.graph.getConstantDrivers(*node));
+    sources.push_back(node.get());
+  }
+  auto drivers = test.graph.getDrivers("m.y", DriverBitRange{3, 0});
+  auto fanOutMany = test.graph.getCombFanOutMany(sources);
+  auto fanInMany = test.graph.getCombFanInMany(sources);
+  auto numEdges = test.graph.numEdges();
+  auto edgeArena = test.graph.getEdgeArenaStats();
+  REQUIRE(edgeArena.allocations == numEdges);
+
+  test.graph.freeze(/*releaseEdges=*/true);
+  REQUIRE(test.graph.hasReleasedEdges());
+  CHECK(test.graph.numEdges() == numEdges);
+  CHECK(test.graph.getEdgeArenaStats().bytesUsed == 0);
+  CHECK(test.graph.getEdgeArenaStats().slabs == 0);
+  for (auto const &node : test.graph) {
+    CHECK(node->getOutEdges().empty());
+    CHECK(node->getInEdges().empty());
+  }
+
+  // The snapshot is smaller than the edges it replaces: their arena and
+  // the owning and back pointers of the nodes' edge lists.
+  auto releasedBytes =
+      edgeArena.bytesUsed +
+      numEdges * (sizeof(std::unique_ptr<NetlistEdge>) + sizeof(NetlistEdge *));
+  CHECK(test.graph.getFrozen()->memoryBytes() < releasedBytes);
+
+  // The frozen queries still answer from the snapshot.
+  size_t i = 0;
+  for (auto const &node : test.graph) {
+    CHECK(test.graph.getCombFanOut(*node) == fanOut[i]);
+    CHECK(test.graph.getCombFanIn(*node) == fanIn[i]);
+    CHECK(test.graph.getSensitivity(*node) == sensitivity[i]);
+    CHECK(test.graph.getConstantDrivers(*node) == constants[i]);
+    i++;
+  }
+  CHECK(test.graph.getDrivers("m.y", DriverBitRange{3, 0}) == drivers);
+  CHECK(test.graph.getCombFanOutMany(sources) == fanOutMany);
+  CHECK(test.graph.getCombFanInMany(sources) == fanInMany);
+
+  // Unfreezing rebuilds the edges as they were, in the same order.
+  test.graph.unfreeze();
+  CHECK_FALSE(test.graph.hasReleasedEdges());
+  CHECK(test.graph.numEdges() == numEdges);
+  i = 0;
+  for (auto const &node : test.graph) {
+    REQUIRE(node->getOutEdges().size() == outEdges[i].size());
+    for (size_t j = 0; j < outEdges[i].size(); j++) {
+      auto const &edge = *node->getOutEdges()[j];
+      auto const &record = outEdges[i][j];
+      CHECK(&edge.getSourceNode() == node.get());
+      CHECK(&edge.getTargetNode() == record.target);
+      CHECK(edge.symbol == record.symbol);
+      CHECK(edge.bounds == record.bounds);
+      CHECK(edge.edgeKind == record.edgeKind);
+      CHECK(edge.disabled == record.disabled);
+    }
+    REQUIRE(node->getInEdges().size() == inSources[i].size());
+    for (size_t j = 0; j < inSources[i].size(); j++) {
+      CHECK(&node->getInEdges()[j]->getSourceNode() == inSources[i][j]);
+    }
+    CHECK(test.graph.getCombFanOut(*node) == fanOut[i]);
+    i++;
+  }
+}
+
+TEST_CASE("Driver queries match edges by path whatever table interned them",
+          "[Frozen]") {
+  auto const &tree = R"(
+  module m(input logic [3:0] a, input logic [3:0] b, output logic [3:0] y,
+           output logic [3:0] z);
+    assign y = a;
+    assign z = b;
+  endmodule
+  )";
+  NetlistTest test(tree);
+  auto *b = test.graph.lookup("m.b");
+  auto *z = test.graph.lookup("m.z");
+  REQUIRE(b != nullptr);
+  REQUIRE(z != nullptr);
+
+  // Annotate edges with records from another table: one with a path the
+  // graph also interned and one with a path it did not.
+  SymbolTable other;
+  auto &toY = test.graph.addEdge(*b, *z);
+  toY.symbol = other.intern("y", "m.y", TextLocation{});
+  toY.bounds = DriverBitRange{3, 0};
+  auto &toW = test.graph.addEdge(*b, *z);
+  toW.symbol = other.intern("w", "m.w", TextLocation{});
+  toW.bounds = DriverBitRange{1, 0};
+
+  auto y = test.graph.getDrivers("m.y", DriverBitRange{3, 0});
+  auto w = test.graph.getDrivers("m.w", DriverBitRange{3, 0});
+  CHECK(std::ranges::find(y, b) != y.end());
+  CHECK(w == std::vector<NetlistNode *>{b});
+  auto bitY = test.graph.getBitDrivers("m.y");
+
+  test.graph.freeze();
+  CHECK(test.graph.getDrivers("m.y", DriverBitRange{3, 0}) == y);
+  CHECK(test.graph.getDrivers("m.w", DriverBitRange{3, 0}) == w);
+  auto frozenBitY = test.graph.getBitDrivers("m.y");
+  REQUIRE(frozenBitY.size() == bitY.size());
+  for (size_t i = 0; i < bitY.size(); i++) {
+    CHECK(frozenBitY[i].driver == bitY[i].driver);
+    CHECK(frozenBitY[i].bounds == bitY[i].bounds);
+  }
+}
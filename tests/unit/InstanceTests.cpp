@@ -561,7 +561,7 @@ endmodule
       REQUIRE(n->kind == NodeKind::Port);
       auto &port = n->as<Port>();
       CHECK(port.direction == e.direction);
-      CHECK(std::string(port.hierarchicalPath) == e.path);
+      CHECK(port.symbol->getHierarchicalPath() == e.path);
       for (uint64_t b = port.bounds.lower(); b <= port.bounds.upper(); ++b) {
         if (b >= e.bounds.lower() && b <= e.bounds.upper()) {
           covered |= (uint64_t{1} << b);
@@ -90,7 +90,8 @@ endmodule
   for (auto &node : test.graph) {
     for (auto &edge : node->getOutEdges()) {
       if (edge->symbol != nullptr && !edge->symbol->empty()) {
-        disabledEdgeLabel = edge->symbol->name + toString(edge->bounds);
+        disabledEdgeLabel =
+            std::string(edge->symbol->name) + toString(edge->bounds);
         edge->disable();
         foundEdge = true;
         break;
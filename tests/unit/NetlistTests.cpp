@@ -1,5 +1,12 @@
 #include "Test.hpp"
 
+#include "common/Wildcard.hpp"
+
+#include <fmt/format.h>
+#include <regex>
+#include <thread>
+#include <unordered_set>
+
 TEST_CASE("NetlistGraph::filterNodes", "[Netlist]") {
   auto const &tree = R"(
 module m(input logic a, output logic b);
@@ -289,6 +296,165 @@ endmodule
   }
 }
 
+TEST_CASE("findNodes through the hierarchy trie agrees with wildcardMatch",
+          "[Netlist]") {
+  // Paths of one to four segments drawn from a small alphabet, so that
+  // patterns hit shared prefixes, repeated names and empty segments.
+  NetlistGraph graph;
+  std::vector<std::string> const segments = {"a",  "b",  "ab", "a_b",
+                                             "u0", "u1", ""};
+  for (size_t i = 0; i < 2000; i++) {
+    std::string path;
+    auto depth = 1 + i % 4;
+    for (size_t d = 0, x = i; d < depth; d++, x /= segments.size()) {
+      path += (d == 0 ? "" : ".") + segments[x % segments.size()];
+    }
+    auto *symbol = graph.symbolTable.intern(path, path, TextLocation{});
+    graph.addNode(std::make_unique<Variable>(symbol, TextLocation{},
+                                             DriverBitRange{0, 0}));
+  }
+  auto const &table = graph.getNodeTable();
+
+  auto expect = [&](std::string const &pattern) {
+    std::vector<NetlistNode *> expected;
+    for (size_t row = 0; row < table.size(); row++) {
+      std::string path(*table.getPath(row));
+      if (wildcardMatch(path.c_str(), pattern.c_str())) {
+        expected.push_back(&table.getNode(row));
+      }
+    }
+    return expected;
+  };
+
+  for (std::string pattern :
+       {"**", "...", "*", "a", "a.*", "a.**", "a.**.b", "**.b", "*.?",
+        "a?b", "u?.**.a*", "a...", "a.**b", "a.u0...", "**a", "a.**.**",
+        ".**.**", "....?", "a..b", "a.", ".", "", "*.*.*.*", "u0.**.**.a",
+        "**.u1.**", "a_*.**.?"}) {
+    INFO("pattern: " << pattern);
+    auto found = graph.findNodes(pattern);
+    auto expected = expect(pattern);
+    std::ranges::sort(found);
+    std::ranges::sort(expected);
+    CHECK(found == expected);
+  }
+
+  // Results are listed by a pre-order walk of the hierarchy, so the nodes
+  // at a path come before the nodes below it.
+  auto all = graph.findNodes("**");
+  CHECK(all.size() == table.size());
+  for (size_t i = 1; i < all.size(); i++) {
+    auto path = *all[i]->getHierarchicalPath();
+    auto previous = *all[i - 1]->getHierarchicalPath();
+    CHECK((previous == path || !pathInScope(previous, path)));
+  }
+}
+
+TEST_CASE("NetlistGraph::findNodesInScope", "[Netlist]") {
+  auto const &tree = R"(
+module sub(input logic d, output logic q);
+  assign q = d;
+endmodule
+
+module top(input logic a, output logic b, output logic c);
+  sub u0(.d(a), .q(b));
+  sub u01(.d(a), .q(c));
+endmodule
+)";
+  const NetlistTest test(tree);
+  auto const &table = test.graph.getNodeTable();
+  for (std::string_view scope : {"top", "top.u0", "top.u01", "top.u", "x"}) {
+    INFO("scope: " << scope);
+    std::vector<NetlistNode *> expected;
+    for (size_t row = 0; row < table.size(); row++) {
+      auto path = table.getPath(row);
+      if (path.has_value() && pathInScope(*path, scope)) {
+        expected.push_back(&table.getNode(row));
+      }
+    }
+    auto found = test.graph.findNodesInScope(scope);
+    std::ranges::sort(found);
+    std::ranges::sort(expected);
+    CHECK(found == expected);
+  }
+  // `top.u0` does not contain `top.u01`.
+  CHECK_FALSE(test.graph.findNodesInScope("top.u0").empty());
+  for (auto const *node : test.graph.findNodesInScope("top.u0")) {
+    CHECK(pathInScope(*node->getHierarchicalPath(), "top.u0"));
+  }
+  CHECK(test.graph.findNodesInScope("top.u").empty());
+}
+
+TEST_CASE("findNodesRegex with a literal prefix, in parallel, matches a scan",
+          "[Netlist]") {
+  // Enough paths that the regex is matched on several threads.
+  NetlistGraph graph;
+  for (size_t i = 0; i < 12000; i++) {
+    auto path = fmt::format("top.u{}.s{}", i % 7, i);
+    auto *symbol = graph.symbolTable.intern(path, path, TextLocation{});
+    graph.addNode(std::make_unique<Variable>(symbol, TextLocation{},
+                                             DriverBitRange{0, 0}));
+  }
+  auto const &table = graph.getNodeTable();
+
+  auto const all = graph.findNodes("**");
+  auto findWithThreads = [&](std::string const &pattern, unsigned threads) {
+    BuildProfile profile;
+    profile.numThreads = threads;
+    graph.setBuildProfile(profile);
+    return graph.findNodesRegex(pattern);
+  };
+
+  for (std::string pattern :
+       {"top\\.u3\\..*", "top\\.u[35]\\.s1.*", "^top\\.u1\\.s\\d+7",
+        "top\\.u?2.*", "top\\.u2|top\\.u4\\.s4", "(top)\\.u6\\.s6.*",
+        ".*s11.*", "top\\.u0\\.s(0|7)", "top\\.x.*"}) {
+    INFO("pattern: " << pattern);
+    std::regex re(pattern);
+    std::unordered_set<NetlistNode *> matching;
+    for (size_t row = 0; row < table.size(); row++) {
+      auto path = *table.getPath(row);
+      if (std::regex_match(path.begin(), path.end(), re)) {
+        matching.insert(&table.getNode(row));
+      }
+    }
+    // Matches are listed in the same order as findNodes, whatever the
+    // number of threads.
+    std::vector<NetlistNode *> expected;
+    std::ranges::copy_if(all, std::back_inserter(expected),
+                         [&](NetlistNode *node) {
+                           return matching.contains(node);
+                         });
+    CHECK(findWithThreads(pattern, 4) == expected);
+    CHECK(findWithThreads(pattern, 1) == expected);
+    CHECK(graph.findNodesRegex(pattern, /*parallel=*/false) == expected);
+  }
+
+  // The graph's pool is reused across calls and shared by concurrent
+  // callers, each of which waits only on its own blocks.
+  BuildProfile profile;
+  profile.numThreads = 4;
+  graph.setBuildProfile(profile);
+  auto const expected = graph.findNodesRegex("top\\.u[35]\\..*");
+  std::vector<std::vector<NetlistNode *>> results(4);
+  {
+    std::vector<std::thread> callers;
+    for (auto &result : results) {
+      callers.emplace_back([&graph, &result] {
+        result = graph.findNodesRegex("top\\.u[35]\\..*");
+      });
+    }
+    for (auto &caller : callers) {
+      caller.join();
+    }
+  }
+  for (auto const &result : results) {
+    CHECK(result == expected);
+  }
+
+  CHECK_THROWS_AS(graph.findNodesRegex("top\\.u("), std::regex_error);
+}
+
 TEST_CASE("NetlistGraph::findNodesRegex", "[Netlist]") {
   auto const &tree = R"(
 module m(input logic a, input logic b, output logic x, output logic y);
@@ -324,3 +490,239 @@ endmodule
   REQUIRE(portX != nullptr);
   CHECK_FALSE(portB->removeEdge(*portX));
 }
+
+TEST_CASE("Symbol table shares scope prefixes", "[Netlist]") {
+  SymbolTable table;
+  auto const *a = table.intern("a", "top.u0.a", TextLocation{});
+  auto const *b = table.intern("b", "top.u0.b", TextLocation{});
+  auto const *u0 = table.intern("u0", "top.u0", TextLocation{});
+  auto const *c = table.intern("c", "c", TextLocation{});
+  CHECK(table.intern("a", "top.u0.a", TextLocation{}) == a);
+  CHECK(table.size() == 4);
+
+  // The root, top and top.u0.
+  CHECK(table.numScopes() == 3);
+  CHECK(a->scope == b->scope);
+  CHECK(a->scope->path == "top.u0");
+  CHECK(a->scope->segment == "u0");
+  CHECK(a->scope->depth == 2);
+  CHECK(a->scope->parent == u0->scope);
+  CHECK(c->scope->parent == nullptr);
+  CHECK(table.findScope("top.u0") == a->scope);
+  CHECK(table.findScope("top.u1") == nullptr);
+  // Each scope path and each leaf is stored once.
+  CHECK(table.getStringBytes() == 3 + 6 + 1 + 1 + 2 + 1);
+
+  CHECK(a->getHierarchicalPath() == "top.u0.a");
+  CHECK(c->getHierarchicalPath() == "c");
+  CHECK(a->hasPath("top.u0.a"));
+  CHECK_FALSE(a->hasPath("top.u0.b"));
+  CHECK_FALSE(a->hasPath("top.u0xa"));
+  CHECK(table.find("top.u0.b") == b);
+  CHECK(table.find("top.u0") == u0);
+  CHECK(table.find("top.u1.a") == nullptr);
+  CHECK(table.find("top") == nullptr);
+}
+
+TEST_CASE("Nodes share interned symbol records", "[Netlist]") {
+  auto const &tree = R"(
+module m(input clk, input logic [3:0] a, output logic [3:0] x);
+  logic [3:0] q;
+  always_ff @(posedge clk) begin
+    q[1:0] <= a[1:0];
+    q[3:2] <= a[3:2];
+  end
+  assign x = q;
+endmodule
+)";
+  const NetlistTest test(tree);
+  auto *a = test.graph.lookup("m.a");
+  REQUIRE(a != nullptr);
+  auto const *symbol = a->as<Port>().symbol;
+  REQUIRE(symbol != nullptr);
+  CHECK(symbol->name == "a");
+  CHECK(symbol->getHierarchicalPath() == "m.a");
+  CHECK(symbol->leaf == "a");
+  CHECK(symbol->scope->path == "m");
+  // The name is a view onto the leaf, not a separate copy.
+  CHECK(symbol->name.data() == symbol->leaf.data());
+
+  // Edges reading the port refer to the same record as the port node.
+  for (auto const &edge : a->getOutEdges()) {
+    if (edge->symbol != nullptr) {
+      CHECK(edge->symbol == symbol);
+    }
+  }
+
+  // Every State slice of q shares one record.
+  std::vector<SymbolReference const *> stateSymbols;
+  for (auto const &node : test.graph.filterNodes(NodeKind::State)) {
+    stateSymbols.push_back(node->as<State>().symbol);
+  }
+  REQUIRE(stateSymbols.size() == 2);
+  CHECK(stateSymbols[0] == stateSymbols[1]);
+  CHECK(stateSymbols[0]->getHierarchicalPath() == "m.q");
+  // Symbols of one scope share it.
+  CHECK(stateSymbols[0]->scope == symbol->scope);
+}
+
+TEST_CASE("Node table mirrors node attributes", "[Netlist]") {
+  auto const &tree = R"(
+module m(input clk, input logic [3:0] a, input logic s,
+         output logic [3:0] x);
+  logic [3:0] q;
+  always_ff @(posedge clk)
+    if (s) q <= a;
+    else q <= 4'd3;
+  assign x = q;
+endmodule
+)";
+  const NetlistTest test(tree);
+  auto const &table = test.graph.getNodeTable();
+  REQUIRE(table.size() == test.graph.numNodes());
+  size_t i = 0;
+  for (auto const &node : test.graph) {
+    CHECK(&table.getNode(i) == node.get());
+    CHECK(table.getID(i) == node->ID);
+    CHECK(table.getKind(i) == node->kind);
+    CHECK(table.getPath(i) == node->getHierarchicalPath());
+    if (auto bounds = node->getBounds()) {
+      CHECK(table.getBounds(i) == *bounds);
+    }
+    if (auto location = node->getLocation()) {
+      CHECK(table.getLocation(i).fileIndex == location->fileIndex);
+      CHECK(table.getLocation(i).line == location->line);
+      CHECK(table.getLocation(i).column == location->column);
+    }
+    i++;
+  }
+  CHECK(test.graph.filterNodes(NodeKind::State).size() == 1);
+  CHECK(test.graph.filterNodes(NodeKind::Port).size() == 4);
+}
+
+TEST_CASE("Node table is rebuilt after nodes are removed", "[Netlist]") {
+  auto const &tree = R"(
+module m(input logic a, output logic x);
+  assign x = a;
+endmodule
+)";
+  NetlistTest test(tree);
+  CHECK(test.graph.filterNodes(NodeKind::Assignment).size() == 1);
+  CHECK(test.graph.getNodeTable().size() == test.graph.numNodes());
+  test.graph.contractPassThroughNodes();
+  CHECK(test.graph.getNodeTable().size() == test.graph.numNodes());
+  CHECK(test.graph.filterNodes(NodeKind::Assignment).empty());
+  CHECK(test.graph.filterNodes(NodeKind::Port).size() == 2);
+}
+
+TEST_CASE("Name index and trie are rebuilt after nodes are removed",
+          "[Netlist]") {
+  auto const &tree = R"(
+module m(input logic a, input logic b, output logic x);
+  assign x = a & b;
+endmodule
+)";
+  NetlistTest test(tree);
+  auto *a = test.graph.lookup("m.a");
+  REQUIRE(a != nullptr);
+  CHECK(test.graph.findNodes("m.*").size() == 3);
+  CHECK(test.graph.findNodesInScope("m").size() == 3);
+  REQUIRE(test.graph.removeNode(*a));
+  CHECK(test.graph.getNameIndex().getVersion() ==
+        test.graph.getNodeListVersion());
+  CHECK(test.graph.lookup("m.a") == nullptr);
+  CHECK(test.graph.lookup("m.b") != nullptr);
+  auto matched = test.graph.findNodes("m.*");
+  CHECK(matched.size() == 2);
+  CHECK(std::ranges::find(matched, a) == matched.end());
+  CHECK(test.graph.findNodesInScope("m").size() == 2);
+  CHECK(test.graph.findNodesRegex("m\\..*").size() == 2);
+}
+
+TEST_CASE("Concurrent lookups share one name index", "[Netlist]") {
+  auto const &tree = R"(
+module m(input logic a, input logic b, output logic x, output logic y);
+  assign x = a;
+  assign y = a & b;
+endmodule
+)";
+  const NetlistTest test(tree);
+  std::vector<std::string> const names = {"m.a", "m.b", "m.x", "m.y"};
+  std::vector<std::vector<NetlistNode *>> found(8);
+  std::vector<size_t> matched(8);
+  {
+    std::vector<std::jthread> threads;
+    for (size_t t = 0; t < found.size(); t++) {
+      threads.emplace_back([&, t] {
+        for (auto const &name : names) {
+          found[t].push_back(test.graph.lookup(name));
+        }
+        matched[t] = test.graph.findNodes("m.*").size();
+      });
+    }
+  }
+  for (size_t t = 0; t < found.size(); t++) {
+    CHECK(found[t] == found[0]);
+    CHECK(matched[t] == 4);
+  }
+  for (auto *node : found[0]) {
+    CHECK(node != nullptr);
+  }
+  CHECK(&test.graph.getNameIndex() == &test.graph.getNameIndex());
+  CHECK(test.graph.getNameIndex().size() == 4);
+}
+
+TEST_CASE("Indexes built up front serve later lookups", "[Netlist]") {
+  auto const &tree = R"(
+module m(input logic a, input logic b, output logic x);
+  assign x = a & b;
+endmodule
+)";
+  NetlistTest test(tree);
+  test.graph.freeze();
+  test.graph.buildIndexes();
+  auto const *names = &test.graph.getNameIndex();
+  auto const *trie = &test.graph.getHierarchyTrie();
+  CHECK(test.graph.findNodes("m.*").size() == 3);
+  CHECK_FALSE(
+      test.graph.getDrivers("m.x", netlist::DriverBitRange(0, 0)).empty());
+  CHECK(&test.graph.getNameIndex() == names);
+  CHECK(&test.graph.getHierarchyTrie() == trie);
+}
+
+TEST_CASE("Name index built in parallel matches a sequential build",
+          "[Netlist]") {
+  // Enough nodes to take the parallel path, with several nodes per path.
+  NetlistGraph graph;
+  size_t const numNodes = 40000;
+  size_t const numPaths = 9000;
+  for (size_t i = 0; i < numNodes; i++) {
+    auto path = fmt::format("top.s{}", i % numPaths);
+    auto *symbol =
+        graph.symbolTable.intern(path.substr(4), path, TextLocation{});
+    graph.addNode(std::make_unique<Variable>(symbol, TextLocation{},
+                                             DriverBitRange{0, 0}));
+  }
+  auto const &table = graph.getNodeTable();
+  NameIndex sequential(table, graph.symbolTable, 1);
+  NameIndex parallel(table, graph.symbolTable, 4);
+  CHECK(sequential.numShards() == 1);
+  CHECK(parallel.numShards() == 4);
+  CHECK(sequential.size() == numPaths);
+  CHECK(parallel.size() == numPaths);
+
+  size_t visited = 0;
+  parallel.forEach([&](SymbolReference const &symbol, auto nodes) {
+    visited += nodes.size();
+    auto expected = sequential.find(symbol.getHierarchicalPath());
+    REQUIRE(nodes.size() == expected.size());
+    CHECK(std::ranges::equal(nodes, expected));
+    // Nodes of one path are listed in graph order.
+    CHECK(std::ranges::is_sorted(nodes, {}, [](NetlistNode *node) {
+      return node->getGraphIndex();
+    }));
+  });
+  CHECK(visited == numNodes);
+  CHECK(parallel.find("top.s0").size() == 5);
+  CHECK(parallel.find("top.none").empty());
+}
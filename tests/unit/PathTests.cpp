@@ -1,4 +1,12 @@
 #include "Test.hpp"
+#include "netlist/LogicLevels.hpp"
+#include "netlist/PathEnumerator.hpp"
+#include "netlist/ReachabilityIndex.hpp"
+
+#include <chrono>
+#include <set>
+#include <thread>
+#include <vector>
 
 TEST_CASE("NetlistPath constructor from node list", "[Path]") {
   auto const &tree = R"(
@@ -109,6 +117,226 @@ endmodule
   CHECK(path.empty());
 }
 
+TEST_CASE("PathFinder search modes", "[Path]") {
+  // a reaches b directly and through a chain and a loop; the register
+  // only has a sequential path from a.
+  auto const &tree = R"(
+module m(input clk, input logic a, output logic b, output logic r);
+  logic x, y, z;
+  assign x = a | z;
+  assign y = x;
+  assign z = y;
+  assign b = y | a;
+  always_ff @(posedge clk)
+    r <= b;
+endmodule
+)";
+  NetlistTest test(tree);
+  PathFinder depthFirst;
+  PathFinder shortest(PathFinder::Mode::Shortest);
+  PathFinder bidirectional(PathFinder::Mode::Bidirectional);
+  CHECK(depthFirst.getMode() == PathFinder::Mode::DepthFirst);
+  for (auto const &from : test.graph) {
+    for (auto const &to : test.graph) {
+      for (auto comb : {false, true}) {
+        auto find = [&](PathFinder &finder) {
+          return comb ? finder.findComb(*from, *to) : finder.find(*from, *to);
+        };
+        auto first = find(depthFirst);
+        auto fewest = find(shortest);
+        auto both = find(bidirectional);
+        REQUIRE(fewest.empty() == first.empty());
+        REQUIRE(both.empty() == first.empty());
+        if (from == to) {
+          CHECK(first.empty());
+        }
+        if (first.empty()) {
+          continue;
+        }
+        CHECK(fewest.size() <= first.size());
+        CHECK(both.size() == fewest.size());
+        for (auto const &path : {fewest, both}) {
+          CHECK(path.front() == from.get());
+          CHECK(path.back() == to.get());
+          for (size_t i = 0; i + 1 < path.size(); i++) {
+            CHECK(path[i]->findEdgeTo(*path[i + 1]) != path[i]->end());
+          }
+        }
+      }
+    }
+  }
+
+  // The direct assignment is shorter than the chain through x and y.
+  auto *a = test.graph.lookup("m.a");
+  auto *b = test.graph.lookup("m.b");
+  auto *y = test.graph.lookup("m.y");
+  auto *r = test.graph.lookup("m.r");
+  REQUIRE(a);
+  REQUIRE(b);
+  REQUIRE(y);
+  REQUIRE(r);
+  CHECK(shortest.find(*a, *b).size() <
+        shortest.find(*a, *y).size() + shortest.find(*y, *b).size() - 1);
+  CHECK_FALSE(bidirectional.find(*a, *r).empty());
+  CHECK(bidirectional.findComb(*a, *r).empty());
+  bidirectional.setMode(PathFinder::Mode::Shortest);
+  CHECK(bidirectional.getMode() == PathFinder::Mode::Shortest);
+}
+
+TEST_CASE("PathFinder follows only the selected bits", "[Path]") {
+  auto const &tree = R"(
+module m(input logic [7:0] a, output logic [3:0] x, output logic [3:0] y);
+  logic [3:0] t;
+  assign t = a[3:0];
+  assign x = t;
+  assign y = a[7:4];
+endmodule
+)";
+  NetlistTest test(tree);
+  auto *a = test.graph.lookup("m.a");
+  auto *x = test.graph.lookup("m.x");
+  auto *y = test.graph.lookup("m.y");
+  REQUIRE(a);
+  REQUIRE(x);
+  REQUIRE(y);
+  PathFinder finder;
+  auto path = finder.findComb(*a, DriverBitRange{2, 1}, *x);
+  REQUIRE_FALSE(path.empty());
+  CHECK(path.front() == a);
+  CHECK(path.back() == x);
+  for (size_t i = 0; i + 1 < path.size(); i++) {
+    CHECK(path[i]->findEdgeTo(*path[i + 1]) != path[i]->end());
+  }
+  CHECK(finder.find(*a, DriverBitRange{5, 4}, *x).empty());
+  CHECK_FALSE(finder.find(*a, DriverBitRange{5, 4}, *y).empty());
+  CHECK(finder.find(*a, DriverBitRange{2, 1}, *a).empty());
+}
+
+TEST_CASE("PathEnumerator reports each path once", "[Path]") {
+  auto const &tree = R"(
+module m(input clk, input logic a, output logic b, output logic r);
+  logic x, y;
+  assign x = a;
+  assign y = a;
+  assign b = x | y | a;
+  always_ff @(posedge clk)
+    r <= b;
+endmodule
+)";
+  NetlistTest test(tree);
+  auto *a = test.graph.lookup("m.a");
+  auto *b = test.graph.lookup("m.b");
+  auto *r = test.graph.lookup("m.r");
+  REQUIRE(a);
+  REQUIRE(b);
+  REQUIRE(r);
+
+  // Through x, through y and direct, the first a shortest path.
+  PathEnumerator paths(*a, *b);
+  std::set<std::vector<NetlistNode const *>> found;
+  auto const shortest = PathFinder(PathFinder::Mode::Shortest).find(*a, *b);
+  while (auto path = paths.next()) {
+    if (found.empty()) {
+      CHECK(path->size() == shortest.size());
+    }
+    CHECK(path->front() == a);
+    CHECK(path->back() == b);
+    CHECK(found.emplace(path->begin(), path->end()).second);
+  }
+  CHECK(found.size() >= 3);
+  CHECK(paths.numPaths() == found.size());
+  CHECK(paths.getStatus() == PathEnumerator::Status::Exhausted);
+  CHECK_FALSE(paths.next());
+
+  PathEnumerator first(*a, *b, PathLimits{.maxPaths = 1});
+  CHECK(first.next());
+  CHECK_FALSE(first.next());
+  CHECK(first.getStatus() == PathEnumerator::Status::PathLimit);
+
+  PathEnumerator direct(*a, *b,
+                        PathLimits{.maxDepth = shortest.size() - 1});
+  size_t numDirect = 0;
+  while (auto path = direct.next()) {
+    CHECK(path->size() == shortest.size());
+    numDirect++;
+  }
+  CHECK(numDirect < found.size());
+
+  // Paths to the register pass through its input, which is not
+  // combinational.
+  CHECK(PathEnumerator(*a, *r).next());
+  CHECK_FALSE(PathEnumerator(*a, *r, {}, true).next());
+  CHECK_FALSE(PathEnumerator(*a, *a).next());
+
+  // Once the time limit has passed no more paths are reported.
+  PathEnumerator timed(*a, *b,
+                       PathLimits{.timeLimit = std::chrono::milliseconds(1)});
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  CHECK_FALSE(timed.next());
+  CHECK(timed.getStatus() == PathEnumerator::Status::TimeLimit);
+  CHECK(timed.numPaths() == 0);
+}
+
+TEST_CASE("Logic levels and the deepest paths to registers", "[Path]") {
+  auto const &tree = R"(
+module m(input clk, input logic a, input logic b, output logic y);
+  logic q, r, t, u;
+  always_ff @(posedge clk)
+    q <= a;
+  assign t = q & b;
+  assign u = t ^ a;
+  always_ff @(posedge clk)
+    r <= u | q;
+  assign y = r;
+endmodule
+)";
+  NetlistTest test(tree);
+  LogicLevels const levels(test.graph);
+  auto *q = test.graph.lookup("m.q");
+  auto *r = test.graph.lookup("m.r");
+  REQUIRE(q);
+  REQUIRE(r);
+  CHECK(levels.getLevel(*q) == 0);
+  CHECK(levels.getLevel(*r) == 0);
+  CHECK(levels.getDepth(*q) >= 1);
+  CHECK(levels.getDepth(*r) >= levels.getDepth(*q) + 2);
+
+  // Every combinational edge leads to a node at least as high.
+  for (auto const &node : test.graph) {
+    CHECK(levels.getLevel(*node) <= levels.maxLevel());
+    for (auto const &edge : node->getOutEdges()) {
+      auto const &target = edge->getTargetNode();
+      if (!edge->disabled && target.kind != NodeKind::State) {
+        CHECK(levels.getLevel(target) >= levels.getLevel(*node));
+      }
+    }
+  }
+
+  auto endpoints = levels.getEndpointsByDepth();
+  REQUIRE_FALSE(endpoints.empty());
+  CHECK(endpoints.front() == r);
+  for (size_t i = 1; i < endpoints.size(); i++) {
+    CHECK(levels.getDepth(*endpoints[i - 1]) >= levels.getDepth(*endpoints[i]));
+  }
+
+  // The deepest path to r starts at a register or input and passes through
+  // as many logic nodes as its depth.
+  auto path = levels.getDeepestPath(*r);
+  REQUIRE(path.size() > 2);
+  CHECK(levels.getLevel(*path.front()) == 0);
+  CHECK(path.back() == r);
+  uint32_t numLogic = 0;
+  for (size_t i = 0; i < path.size(); i++) {
+    auto kind = path[i]->kind;
+    numLogic += kind == NodeKind::Assignment ||
+                kind == NodeKind::Conditional || kind == NodeKind::Case;
+    if (i + 1 < path.size()) {
+      CHECK(path[i]->findEdgeTo(*path[i + 1]) != path[i]->end());
+    }
+  }
+  CHECK(numLogic == levels.getDepth(*r));
+}
+
 TEST_CASE("NetlistPath clear", "[Path]") {
   auto const &tree = R"(
 module m(input logic a, output logic b);
@@ -122,3 +350,60 @@ endmodule
   CHECK(path.empty());
   CHECK(path.size() == 0);
 }
+
+TEST_CASE("ReachabilityIndex agrees with PathFinder::findComb", "[Path]") {
+  // A combinational loop through t, a register, and an unconnected output.
+  auto const &tree = R"(
+module t(input x, output y);
+  assign y = x;
+endmodule
+
+module m(input clk, input logic a, input logic b, output logic x,
+         output logic y, output logic z);
+  wire c, d;
+  logic q;
+  t t(.x(c), .y(d));
+  assign c = d | a;
+  always_ff @(posedge clk)
+    q <= c;
+  assign x = d & b;
+  assign y = q;
+  assign z = 1'b0;
+endmodule
+)";
+  NetlistTest test(tree);
+  auto check = [&] {
+    ReachabilityIndex index(test.graph);
+    CHECK(index.numComponents() < test.graph.numNodes());
+    PathFinder pathFinder;
+    TraversalContext context;
+    for (auto const &from : test.graph) {
+      for (auto const &to : test.graph) {
+        if (from == to) {
+          CHECK(index.reaches(*from, *to));
+          continue;
+        }
+        auto expected = !pathFinder.findComb(*from, *to).empty();
+        CHECK(index.reaches(*from, *to, context) == expected);
+        auto path = index.findPath(*from, *to, context);
+        REQUIRE(path.empty() == !expected);
+        if (!path.empty()) {
+          CHECK(path.front() == from.get());
+          CHECK(path.back() == to.get());
+        }
+      }
+    }
+    auto *a = test.graph.lookup("m.a");
+    auto *x = test.graph.lookup("m.x");
+    auto *y = test.graph.lookup("m.y");
+    REQUIRE(a);
+    REQUIRE(x);
+    REQUIRE(y);
+    CHECK(index.reaches(*a, *x));
+    CHECK_FALSE(index.reaches(*a, *y));
+    CHECK_FALSE(index.reaches(*x, *a));
+  };
+  check();
+  test.graph.freeze();
+  check();
+}
@@ -1,4 +1,9 @@
 #include "Test.hpp"
+#include "netlist/ClockDomainMap.hpp"
+
+#include <fmt/format.h>
+#include <set>
+#include <string>
 
 TEST_CASE("Assigning to a variable", "[SequentialState]") {
   auto const &tree = (R"(
@@ -421,6 +426,48 @@ endmodule
   CHECK(sources[0].edgeKind == ast::EdgeKind::PosEdge);
 }
 
+TEST_CASE("ClockDomainMap agrees with getSensitivity",
+          "[SequentialState][Sensitivity]") {
+  // Two domains, a combinational loop feeding both, and logic that reaches
+  // no register.
+  auto const &tree = R"(
+module m(input clk, input clk2, input rst_n, input logic a, input logic b,
+         input logic s, output logic q1, output logic q2, output logic z);
+  logic x, y;
+  assign x = s ? a : y;
+  assign y = x & b;
+  always_ff @(posedge clk or negedge rst_n)
+    if (!rst_n) q1 <= '0;
+    else        q1 <= y;
+  always_ff @(negedge clk2)
+    q2 <= x | q1;
+  assign z = a ^ b;
+endmodule
+)";
+  const NetlistTest test(tree);
+  ClockDomainMap const map(test.graph);
+  CHECK(map.getSources(ClockDomainMap::empty_domain).empty());
+  for (auto const &node : test.graph) {
+    auto expected = test.graph.getSensitivity(*node);
+    auto actual = map.getSensitivity(*node);
+    CHECK(actual.size() == expected.size());
+    for (auto const &source : expected) {
+      CHECK(std::ranges::find(actual, source) != actual.end());
+    }
+  }
+
+  // Nodes gated by the same clocks share a domain.
+  auto *aPort = test.graph.lookup("m.a");
+  auto *bPort = test.graph.lookup("m.b");
+  auto *zPort = test.graph.lookup("m.z");
+  REQUIRE(aPort);
+  REQUIRE(bPort);
+  REQUIRE(zPort);
+  CHECK(map.getDomain(*aPort) == map.getDomain(*bPort));
+  CHECK(map.getSensitivity(*aPort).size() == 3);
+  CHECK(map.getDomain(*zPort) == ClockDomainMap::empty_domain);
+}
+
 TEST_CASE("Sensitivity: combinational always with no edges has no PosEdge "
           "and no State node",
           "[SequentialState][Sensitivity]") {
@@ -441,3 +488,83 @@ endmodule
   CHECK(test.pathExists("m.x", "m.z"));
   CHECK(test.pathExists("m.y", "m.z"));
 }
+
+TEST_CASE("Register-to-register graph", "[SequentialState]") {
+  auto const &tree = (R"(
+  module m(input clk, input logic a, input logic b, output logic y);
+    logic q1, q2;
+    always_ff @(posedge clk)
+      q1 <= a & b;
+    always_ff @(posedge clk)
+      q2 <= q1 + q2;
+    assign y = q2;
+  endmodule
+  )");
+  NetlistTest test(tree);
+  auto const &seq = test.graph.getSequentialGraph();
+  CHECK(&seq == &test.graph.getSequentialGraph());
+
+  // Name each edge by the paths of its endpoints.
+  std::set<std::string> edges;
+  for (SequentialGraph::NodeIndex from = 0; from < seq.numNodes(); from++) {
+    auto &node = seq.getNode(from);
+    REQUIRE(seq.getIndex(node) == from);
+    for (auto to : seq.successors(from)) {
+      edges.insert(fmt::format("{}->{}", *node.getHierarchicalPath(),
+                               *seq.getNode(to).getHierarchicalPath()));
+    }
+  }
+  CHECK(edges.size() == seq.numEdges());
+  CHECK(edges.contains("m.a->m.q1"));
+  CHECK(edges.contains("m.b->m.q1"));
+  CHECK(edges.contains("m.q1->m.q2"));
+  CHECK(edges.contains("m.q2->m.q2"));
+  CHECK(edges.contains("m.q2->m.y"));
+  CHECK_FALSE(edges.contains("m.a->m.q2"));
+  CHECK_FALSE(edges.contains("m.q1->m.q1"));
+  CHECK_FALSE(edges.contains("m.clk->m.q1"));
+  CHECK_FALSE(edges.contains("m.clk->m.q2"));
+
+  // Only State nodes and top-level ports are nodes of the graph.
+  for (auto const &node : test.graph) {
+    auto index = seq.getIndex(*node);
+    CHECK((index != SequentialGraph::null_index) ==
+          (node->kind == NodeKind::State || node->kind == NodeKind::Port));
+    if (index == SequentialGraph::null_index) {
+      continue;
+    }
+    for (auto from : seq.predecessors(index)) {
+      auto successors = seq.successors(from);
+      CHECK(std::ranges::find(successors, index) != successors.end());
+    }
+  }
+}
+
+TEST_CASE("Register-to-register graph is rebuilt after nodes are removed",
+          "[SequentialState]") {
+  auto const &tree = (R"(
+  module m(input clk, input logic a, output logic y);
+    logic q;
+    always_ff @(posedge clk)
+      q <= a;
+    assign y = q;
+  endmodule
+  )");
+  NetlistTest test(tree);
+  auto const numNodes = test.graph.getSequentialGraph().numNodes();
+  auto *a = test.graph.lookup("m.a");
+  REQUIRE(a != nullptr);
+  REQUIRE(test.graph.removeNode(*a));
+  auto const &seq = test.graph.getSequentialGraph();
+  CHECK(seq.getVersion() == test.graph.getNodeListVersion());
+  CHECK(seq.numNodes() == numNodes - 1);
+  for (auto const &node : test.graph) {
+    auto index = seq.getIndex(*node);
+    if (index != SequentialGraph::null_index) {
+      CHECK(&seq.getNode(index) == node.get());
+    }
+  }
+  for (SequentialGraph::NodeIndex n = 0; n < seq.numNodes(); n++) {
+    CHECK(&seq.getNode(n) != a);
+  }
+}
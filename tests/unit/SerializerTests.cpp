@@ -62,7 +62,7 @@ endmodule
   // Check Port nodes have matching locations.
   for (auto const &nodePtr : test.graph.filterNodes(NodeKind::Port)) {
     auto const &orig = nodePtr->as<Port>();
-    auto *found = loaded->lookup(orig.hierarchicalPath);
+    auto *found = loaded->lookup(orig.symbol->getHierarchicalPath());
     REQUIRE(found != nullptr);
     auto const &port = found->as<Port>();
     CHECK(port.location.fileIndex == orig.location.fileIndex);
@@ -92,7 +92,7 @@ endmodule
       auto const &origSym = *edgePtr->symbol;
 
       // Find the corresponding edge in the loaded graph.
-      auto *srcNode = loaded->lookup(origSym.hierarchicalPath);
+      auto *srcNode = loaded->lookup(origSym.getHierarchicalPath());
       if (!srcNode) {
         continue;
       }
@@ -214,7 +214,7 @@ endmodule
   CHECK(loadedPort.direction == origPort.direction);
   CHECK(loadedPort.bounds.lower() == origPort.bounds.lower());
   CHECK(loadedPort.bounds.upper() == origPort.bounds.upper());
-  CHECK(loadedPort.name == origPort.name);
+  CHECK(loadedPort.symbol->name == origPort.symbol->name);
 }
 
 TEST_CASE("Round-trip preserves Conditional and Merge nodes", "[Serializer]") {
@@ -274,7 +274,7 @@ endmodule
   auto stateNodes = loaded->filterNodes(NodeKind::State);
   CHECK_FALSE(stateNodes.empty());
   auto const &state = stateNodes.front()->as<State>();
-  CHECK(state.name == "r");
+  CHECK(state.symbol->name == "r");
 }
 
 TEST_CASE("Round-trip preserves Variable nodes (interface)", "[Serializer]") {
@@ -0,0 +1,127 @@
+#include "Test.hpp"
+
+namespace {
+
+/// Names of the Port, Variable and State nodes in @p nodes, sorted. These
+/// are the node kinds that contraction never removes.
+auto keptNames(std::vector<NetlistNode *> const &nodes)
+    -> std::vector<std::string> {
+  std::vector<std::string> names;
+  for (auto *node : nodes) {
+    if (node->kind != NodeKind::Port && node->kind != NodeKind::Variable &&
+        node->kind != NodeKind::State) {
+      continue;
+    }
+    if (auto path = node->getHierarchicalPath()) {
+      names.emplace_back(*path);
+    }
+  }
+  std::ranges::sort(names);
+  return names;
+}
+
+auto countKind(NetlistGraph const &graph, NodeKind kind) -> size_t {
+  return static_cast<size_t>(std::ranges::count_if(
+      graph, [&](auto const &node) { return node->kind == kind; }));
+}
+
+} // namespace
+
+TEST_CASE("Simplify contracts continuous assignments", "[Simplify]") {
+  auto const &tree = R"(
+  module m(input logic a, input logic b, output logic x, output logic y);
+    assign x = a;
+    assign y = a & b;
+  endmodule
+  )";
+  NetlistTest plain(tree);
+  NetlistTest simple(tree, BuilderOptions{.simplify = true});
+  // Only the single-input assignment is contracted: replacing the two-input
+  // one would need four annotated edges where there are three.
+  CHECK(countKind(plain.graph, NodeKind::Assignment) == 2);
+  CHECK(countKind(simple.graph, NodeKind::Assignment) == 1);
+  CHECK(simple.graph.numNodes() < plain.graph.numNodes());
+  CHECK(simple.graph.getBuildProfile().contractedNodeCount ==
+        plain.graph.numNodes() - simple.graph.numNodes());
+
+  CHECK(simple.pathExists("m.a", "m.x"));
+  CHECK(simple.pathExists("m.a", "m.y"));
+  CHECK(simple.pathExists("m.b", "m.y"));
+  CHECK_FALSE(simple.pathExists("m.b", "m.x"));
+
+  // The symbol annotation of the contracted edge is carried over.
+  CHECK(simple.hasDriverNamed("m.x", {0, 0}, "m.a"));
+  CHECK_FALSE(plain.hasDriverNamed("m.x", {0, 0}, "m.a"));
+}
+
+TEST_CASE("Simplify preserves fan-in and fan-out of variables",
+          "[Simplify]") {
+  auto const &tree = R"(
+  module m(input clk, input rst, input logic [3:0] a, input logic [3:0] b,
+           input logic s, output logic [3:0] x, output logic [3:0] y,
+           output logic [3:0] z);
+    logic [3:0] q;
+    logic [3:0] t;
+    always_ff @(posedge clk or negedge rst)
+      if (!rst) q <= 0;
+      else q <= a ^ b;
+    always_comb begin
+      t = a;
+      if (s) t = b;
+    end
+    assign x = q | t;
+    assign y = {a[1:0], b[3:2]};
+    assign z = a;
+  endmodule
+  )";
+  NetlistTest plain(tree);
+  NetlistTest simple(tree, BuilderOptions{.simplify = true});
+  CHECK(simple.graph.getBuildProfile().contractedNodeCount > 0);
+  CHECK(simple.graph.numEdges() <= plain.graph.numEdges());
+
+  for (auto const *name :
+       {"m.clk", "m.rst", "m.a", "m.b", "m.s", "m.x", "m.y", "m.z"}) {
+    auto *before = plain.graph.lookup(name);
+    auto *after = simple.graph.lookup(name);
+    REQUIRE(before);
+    REQUIRE(after);
+    CHECK(keptNames(simple.graph.getCombFanOut(*after)) ==
+          keptNames(plain.graph.getCombFanOut(*before)));
+    CHECK(keptNames(simple.graph.getCombFanIn(*after)) ==
+          keptNames(plain.graph.getCombFanIn(*before)));
+  }
+
+  // Clock edges into the State nodes are untouched.
+  size_t clocked = 0;
+  for (auto const &node : simple.graph) {
+    if (node->kind != NodeKind::State) {
+      continue;
+    }
+    for (auto const &source : simple.graph.getSensitivity(*node)) {
+      auto path = source.source->getHierarchicalPath();
+      if (path && *path == "m.clk" &&
+          source.edgeKind == ast::EdgeKind::PosEdge) {
+        clocked++;
+      }
+    }
+  }
+  CHECK(clocked > 0);
+  CHECK(simple.hasDriverNamed("m.z", {3, 0}, "m.a"));
+}
+
+TEST_CASE("Simplify is off by default", "[Simplify]") {
+  auto const &tree = R"(
+  module m(input logic a, output logic x);
+    assign x = a;
+  endmodule
+  )";
+  NetlistTest test(tree);
+  CHECK(countKind(test.graph, NodeKind::Assignment) == 1);
+  CHECK(test.graph.getBuildProfile().contractedNodeCount == 0);
+  auto removed = test.graph.contractPassThroughNodes();
+  CHECK(removed == 1);
+  CHECK(countKind(test.graph, NodeKind::Assignment) == 0);
+  CHECK(test.pathExists("m.a", "m.x"));
+  // A second pass finds nothing left to contract.
+  CHECK(test.graph.contractPassThroughNodes() == 0);
+}
@@ -149,8 +149,8 @@ endmodule
   REQUIRE(nodeB);
   CHECK(nodeA->kind == NodeKind::Port);
   CHECK(nodeB->kind == NodeKind::Port);
-  CHECK(nodeA->as<Port>().name == "a");
-  CHECK(nodeB->as<Port>().name == "b");
+  CHECK(nodeA->as<Port>().symbol->name == "a");
+  CHECK(nodeB->as<Port>().symbol->name == "b");
   CHECK(nodeA->as<Port>().bounds.lower() == 0);
   CHECK(nodeA->as<Port>().bounds.upper() == 3);
 }
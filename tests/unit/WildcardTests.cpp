@@ -4,6 +4,7 @@
 
 using slang::netlist::pathInScope;
 using slang::netlist::wildcardMatch;
+using slang::netlist::WildcardSet;
 
 TEST_CASE("wildcardMatch exact literal", "[Wildcard]") {
   CHECK(wildcardMatch("foo.bar", "foo.bar"));
@@ -109,6 +110,56 @@ TEST_CASE("wildcardMatch combinations", "[Wildcard]") {
   CHECK(wildcardMatch("top.u_ab", "top.u_?*"));
 }
 
+TEST_CASE("WildcardSet agrees with wildcardMatch", "[Wildcard]") {
+  std::vector<std::string> const patterns = {
+      "",         "*",      "?",        "**",      "...",      "a",
+      "a.b",      "a.*",    "*.b",      "a?b",     "a.**",     "**.b",
+      "a.**.b",   "a...",   "a.**b",    ".**",     ".**.b",    "a.**.**",
+      "....?",    "a..b",   "**..b",    "*.**.*",  "a_*.**.?", "**a**",
+      ".........", "a.*.**", "top.u_?*", "..",      "**.",      "a.**."};
+  std::vector<std::string> const texts = {
+      "",      "a",       "b",     ".",       "..",      "ab",
+      "a.b",   "a.x.b",   "a..b",  "a.x.y.b", "ab.b",    "a.",
+      ".a",    ".b",      "a.b.c", "top.u_a", "top.u_ab", "a_x.y.z",
+      "x.a.b", "b.a",     "aab",   "a.ab",    "...",     "a...b"};
+  for (auto const &pattern : patterns) {
+    WildcardSet set;
+    set.add(pattern);
+    for (auto const &text : texts) {
+      INFO("pattern: '" << pattern << "', text: '" << text << "'");
+      CHECK(set.matches(text) == wildcardMatch(text.c_str(), pattern.c_str()));
+    }
+  }
+}
+
+TEST_CASE("WildcardSet matches any of its patterns", "[Wildcard]") {
+  CHECK(WildcardSet().empty());
+  CHECK_FALSE(WildcardSet().matches(""));
+
+  std::vector<std::string> const patterns = {"top.u_*", "**.clk", "mem"};
+  WildcardSet set(patterns);
+  CHECK(set.size() == 3);
+  CHECK(set.matches("top.u_a"));
+  CHECK(set.matches("top.u_a.x.clk"));
+  CHECK(set.matches("mem"));
+  CHECK_FALSE(set.matches("top.u_a.x"));
+  CHECK_FALSE(set.matches("memory"));
+
+  // Subjects are views, and need not be null-terminated.
+  std::string_view path = "top.u_b.y";
+  CHECK(set.matches(path.substr(0, 7)));
+  CHECK_FALSE(set.matches(path));
+
+  // Enough patterns that the live states no longer fit in one word.
+  WildcardSet many;
+  for (int i = 0; i < 100; i++) {
+    many.add("top.u" + std::to_string(i) + ".**");
+  }
+  CHECK(many.matches("top.u99.x.y"));
+  CHECK(many.matches("top.u0"));
+  CHECK_FALSE(many.matches("top.u100"));
+}
+
 TEST_CASE("pathInScope subtree matching", "[Wildcard]") {
   // A scope contains itself and any descendant.
   CHECK(pathInScope("top.cpu", "top.cpu"));
@@ -5,10 +5,12 @@
 #include "netlist/BuilderOptions.hpp"
 #include "netlist/CombLoops.hpp"
 #include "netlist/Debug.hpp"
+#include "netlist/LogicLevels.hpp"
 #include "netlist/NetlistDiagnostics.hpp"
 #include "netlist/NetlistDot.hpp"
 #include "netlist/NetlistGraph.hpp"
 #include "netlist/NetlistSerializer.hpp"
+#include "netlist/PathEnumerator.hpp"
 #include "netlist/PathFinder.hpp"
 #include "netlist/VisitAll.hpp"
 
@@ -23,11 +25,14 @@
 
 #include "fmt/color.h"
 #include "fmt/format.h"
+#include "fmt/ranges.h"
+#include <BS_thread_pool.hpp>
 #include <algorithm>
 #include <cctype>
 #include <charconv>
 #include <chrono>
 #include <iostream>
+#include <numeric>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -63,11 +68,11 @@ void reportNodeDiag(NetlistDiagnostics &diagnostics, NetlistNode const &node) {
     auto srcLoc = port.location.sourceLocation;
     if (port.isInput()) {
       Diagnostic diagnostic(diag::InputPort, srcLoc);
-      diagnostic << port.name;
+      diagnostic << port.symbol->name;
       diagnostics.issue(diagnostic);
     } else if (port.isOutput()) {
       Diagnostic diagnostic(diag::OutputPort, srcLoc);
-      diagnostic << port.name;
+      diagnostic << port.symbol->name;
       diagnostics.issue(diagnostic);
     } else {
       SLANG_UNREACHABLE;
@@ -103,7 +108,7 @@ void reportNodeDiag(NetlistDiagnostics &diagnostics, NetlistNode const &node) {
 void reportEdgeDiag(NetlistDiagnostics &diagnostics, NetlistEdge &edge) {
   if (edge.symbol != nullptr && !edge.symbol->empty()) {
     Diagnostic diagnostic(diag::Value, edge.symbol->location.sourceLocation);
-    diagnostic << fmt::format("{}{}", edge.symbol->hierarchicalPath,
+    diagnostic << fmt::format("{}{}", edge.symbol->getHierarchicalPath(),
                               toString(edge.bounds));
     diagnostics.issue(diagnostic);
   }
@@ -116,9 +121,9 @@ void reportNodeText(netlist::FormatBuffer &buffer, FileTable const &fileTable,
     auto const &port = node.as<Port>();
     auto loc = port.location.toString(fileTable);
     if (port.isInput()) {
-      buffer.format("{}: note: input port {}\n", loc, port.name);
+      buffer.format("{}: note: input port {}\n", loc, port.symbol->name);
     } else if (port.isOutput()) {
-      buffer.format("{}: note: output port {}\n", loc, port.name);
+      buffer.format("{}: note: output port {}\n", loc, port.symbol->name);
     } else {
       SLANG_UNREACHABLE;
     }
@@ -154,7 +159,7 @@ void reportEdgeText(netlist::FormatBuffer &buffer, FileTable const &fileTable,
   if (edge.symbol != nullptr && !edge.symbol->empty()) {
     buffer.format("{}: note: value {}{}\n",
                   edge.symbol->location.toString(fileTable),
-                  edge.symbol->hierarchicalPath, toString(edge.bounds));
+                  edge.symbol->getHierarchicalPath(), toString(edge.bounds));
   }
 }
 
@@ -206,6 +211,51 @@ auto reportPath(FileTable const &fileTable, NetlistDiagnostics *diagnostics,
   return buffer.str();
 }
 
+/// The column headers and rows of a tabular query report.
+struct Report {
+  Utilities::Row header;
+  Utilities::Table table;
+};
+
+/// Write the rows of a table as a JSON array of objects keyed by the
+/// lower-cased column headers.
+void writeJsonRows(JsonWriter &writer, Utilities::Row const &header,
+                   Utilities::Table const &table) {
+  writer.startArray();
+  for (auto const &row : table) {
+    writer.startObject();
+    for (size_t i = 0; i < header.size() && i < row.size(); ++i) {
+      std::string key(header[i].size(), '\0');
+      std::transform(header[i].begin(), header[i].end(), key.begin(),
+                     [](unsigned char c) { return std::tolower(c); });
+      writer.writeProperty(key);
+      writer.writeValue(row[i]);
+    }
+    writer.endObject();
+  }
+  writer.endArray();
+}
+
+/// Split a line of a --queries file into its whitespace-separated words.
+auto splitWords(std::string_view line) -> std::vector<std::string> {
+  std::vector<std::string> words;
+  size_t pos = 0;
+  while (pos < line.size()) {
+    if (std::isspace(static_cast<unsigned char>(line[pos]))) {
+      pos++;
+      continue;
+    }
+    auto end = pos;
+    while (end < line.size() &&
+           !std::isspace(static_cast<unsigned char>(line[end]))) {
+      end++;
+    }
+    words.emplace_back(line.substr(pos, end - pos));
+    pos = end;
+  }
+  return words;
+}
+
 }; // namespace
 
 auto main(int argc, char **argv) -> int {
@@ -249,6 +299,22 @@ auto main(int argc, char **argv) -> int {
   driver.cmdLine.add("--comb-loops", combLoops,
                      "Report any combinational loops in the design to stdout");
 
+  std::optional<uint32_t> combLoopsLimit;
+  driver.cmdLine.add(
+      "--comb-loops-limit", combLoopsLimit,
+      "With --comb-loops, report at most this many loops from each group of "
+      "nodes on a loop together (strongly connected component), which can "
+      "contain exponentially many. Defaults to 100; 0 reports every loop.",
+      "<count>");
+
+  std::optional<uint32_t> logicDepth;
+  driver.cmdLine.add(
+      "--logic-depth", logicDepth,
+      "Report this many of the registers and top-level ports with the most "
+      "levels of combinational logic in front of them, deepest first, with a "
+      "deepest path to each, or all of them if the count is 0",
+      "<count>");
+
   std::optional<bool> noResolveAssignBits;
   driver.cmdLine.add(
       "--no-resolve-assign-bits", noResolveAssignBits,
@@ -265,6 +331,14 @@ auto main(int argc, char **argv) -> int {
       "assignments stay whole-word at port boundaries; "
       "scalar->concat->port->concat->scalar paths are bit-imprecise.");
 
+  std::optional<bool> simplify;
+  driver.cmdLine.add(
+      "--simplify", simplify,
+      "Contract pass-through Assignment, Merge and single-input Conditional "
+      "nodes after building or loading the netlist, connecting their "
+      "sources directly to their targets. Edge annotations are preserved; "
+      "the contracted nodes no longer appear in query results.");
+
   std::vector<std::string> blackBoxes;
   driver.cmdLine.add(
       "--black-box", blackBoxes,
@@ -286,7 +360,8 @@ auto main(int argc, char **argv) -> int {
   driver.cmdLine.add("--from", fromPointName,
                      "Specify a start point from which to trace a path. Used "
                      "alone (without --to), reports the combinational fan-out "
-                     "cone from the node.",
+                     "cone from the node. A bit range, as in name[3:0], "
+                     "traces only the logic those bits pass through.",
                      "<name>");
 
   std::optional<std::string> toPointName;
@@ -296,14 +371,44 @@ auto main(int argc, char **argv) -> int {
                      "to the node.",
                      "<name>");
 
+  std::optional<std::string> pathSearch;
+  driver.cmdLine.add(
+      "--path-search", pathSearch,
+      "How --from/--to searches for a path: 'dfs' (default) returns the first "
+      "path found, 'shortest' a path with the fewest edges, and "
+      "'bidirectional' a shortest path searched from both ends",
+      "<dfs|shortest|bidirectional>");
+
+  std::optional<uint32_t> maxPaths;
+  driver.cmdLine.add(
+      "--max-paths", maxPaths,
+      "With --from/--to, report up to this many distinct paths rather than "
+      "one, or every path if 0. Paths are found one at a time, so a limit "
+      "bounds the work done.",
+      "<count>");
+
+  std::optional<uint32_t> maxPathDepth;
+  driver.cmdLine.add("--max-path-depth", maxPathDepth,
+                     "With --max-paths, only report paths of at most this "
+                     "many edges. Requires --max-paths.",
+                     "<edges>");
+
+  std::optional<uint32_t> pathTimeLimit;
+  driver.cmdLine.add("--path-time-limit", pathTimeLimit,
+                     "With --max-paths, stop looking for paths after this "
+                     "many milliseconds. Requires --max-paths.",
+                     "<ms>");
+
   std::optional<std::string> fanOutName;
   driver.cmdLine.add("--fan-out", fanOutName,
-                     "Report the combinational fan-out cone from a named node",
+                     "Report the combinational fan-out cone from a named node, "
+                     "or from the bits of it given as name[hi:lo] or name[bit]",
                      "<name>");
 
   std::optional<std::string> fanInName;
   driver.cmdLine.add("--fan-in", fanInName,
-                     "Report the combinational fan-in cone to a named node",
+                     "Report the combinational fan-in cone to a named node, "
+                     "or to the bits of it given as name[hi:lo] or name[bit]",
                      "<name>");
 
   std::optional<std::string> sensitivityName;
@@ -343,6 +448,18 @@ auto main(int argc, char **argv) -> int {
   driver.cmdLine.add("--find-regex", findRegexPattern,
                      "Find named nodes matching a regex pattern", "<pattern>");
 
+  std::optional<std::string> queriesFile;
+  driver.cmdLine.add(
+      "--queries", queriesFile,
+      "Run the queries in a file against one netlist, in parallel, and print "
+      "the result of each as a line of JSON, in the order of the file. Each "
+      "line holds a query: fan-out, fan-in, find, find-regex, sensitivity, "
+      "constant-drivers or drivers and its argument, as for the option of "
+      "the same name, or path and a start and finish point. Blank lines and "
+      "lines starting with # are skipped. Cannot be combined with another "
+      "query or report option.",
+      "<file>", CommandLineFlags::FilePath);
+
   std::optional<std::string> format;
   driver.cmdLine.add(
       "--format", format,
@@ -355,10 +472,11 @@ auto main(int argc, char **argv) -> int {
   driver.cmdLine.add(
       "--scope", scopeFilters,
       "Restrict the node-listing query commands (--report-registers, --find, "
-      "--find-regex, --fan-out, --fan-in, --sensitivity) to a hierarchical "
-      "subtree. A node passes if its path is the scope or a descendant of it "
-      "(so `top.cpu` matches `top.cpu.alu.x` but not `top.cpu2`). Literal "
-      "paths only; use --name for globs. May be repeated.",
+      "--find-regex, --fan-out, --fan-in, --sensitivity, --logic-depth) to a "
+      "hierarchical subtree. A node passes if its path is the scope or a "
+      "descendant of it (so `top.cpu` matches `top.cpu.alu.x` but not "
+      "`top.cpu2`). Literal paths only; use --name for globs. May be "
+      "repeated.",
       "<path>");
 
   std::vector<std::string> nameFilters;
@@ -429,6 +547,59 @@ auto main(int argc, char **argv) -> int {
     }
   }
 
+  // Search mode of the --from/--to path queries.
+  auto pathMode = PathFinder::Mode::DepthFirst;
+  if (pathSearch) {
+    if (*pathSearch == "shortest") {
+      pathMode = PathFinder::Mode::Shortest;
+    } else if (*pathSearch == "bidirectional") {
+      pathMode = PathFinder::Mode::Bidirectional;
+    } else if (*pathSearch != "dfs") {
+      fmt::print(stderr,
+                 "error: unknown --path-search value '{}'; expected 'dfs', "
+                 "'shortest' or 'bidirectional'\n",
+                 *pathSearch);
+      return 1;
+    }
+  }
+
+  // The path limits bound the enumeration of --max-paths; the single-path
+  // search takes no limits, so reject them rather than ignore them.
+  if (!maxPaths && (maxPathDepth || pathTimeLimit)) {
+    fmt::print(stderr, "error: {} requires --max-paths\n",
+               maxPathDepth ? "--max-path-depth" : "--path-time-limit");
+    return 1;
+  }
+
+  // A batch of --queries is the only action of a run, so reject any other
+  // action option rather than silently ignoring one of them.
+  if (queriesFile) {
+    std::vector<std::string_view> actions;
+    auto checkAction = [&](bool given, std::string_view option) {
+      if (given) {
+        actions.push_back(option);
+      }
+    };
+    checkAction(reportRegisters.has_value(), "--report-registers");
+    checkAction(combLoops.has_value(), "--comb-loops");
+    checkAction(logicDepth.has_value(), "--logic-depth");
+    checkAction(netlistDotFile.has_value(), "--netlist-dot");
+    checkAction(fromPointName.has_value(), "--from");
+    checkAction(toPointName.has_value(), "--to");
+    checkAction(fanOutName.has_value(), "--fan-out");
+    checkAction(fanInName.has_value(), "--fan-in");
+    checkAction(sensitivityName.has_value(), "--sensitivity");
+    checkAction(constantDriversName.has_value(), "--constant-drivers");
+    checkAction(driversName.has_value(), "--drivers");
+    checkAction(findPattern.has_value(), "--find");
+    checkAction(findRegexPattern.has_value(), "--find-regex");
+    if (!actions.empty()) {
+      fmt::print(stderr, "error: --queries cannot be combined with {}\n",
+                 fmt::join(actions, ", "));
+      return 1;
+    }
+  }
+
   auto writeOutput = [&](std::string_view content) {
     if (outputFile && *outputFile != "-") {
       OS::writeFile(*outputFile, content);
@@ -444,19 +615,7 @@ auto main(int argc, char **argv) -> int {
     if (outputFormat == Format::Json) {
       JsonWriter writer;
       writer.setPrettyPrint(true);
-      writer.startArray();
-      for (auto const &row : table) {
-        writer.startObject();
-        for (size_t i = 0; i < header.size() && i < row.size(); ++i) {
-          std::string key(header[i].size(), '\0');
-          std::transform(header[i].begin(), header[i].end(), key.begin(),
-                         [](unsigned char c) { return std::tolower(c); });
-          writer.writeProperty(key);
-          writer.writeValue(row[i]);
-        }
-        writer.endObject();
-      }
-      writer.endArray();
+      writeJsonRows(writer, header, table);
       writeOutput(fmt::format("{}\n", writer.view()));
     } else {
       netlist::FormatBuffer buffer;
@@ -467,7 +626,9 @@ auto main(int argc, char **argv) -> int {
 
   // Whether a node's hierarchical path passes the --scope/--name filters. A
   // node must fall within some --scope subtree (if any given) and match some
-  // --name glob (if any given). With no filters set, everything passes.
+  // --name glob (if any given). With no filters set, everything passes. The
+  // globs are compiled once into a single matcher.
+  netlist::WildcardSet nameMatcher(nameFilters);
   auto passesFilters = [&](std::string_view path) -> bool {
     if (!scopeFilters.empty()) {
       auto inScope = std::any_of(
@@ -477,17 +638,7 @@ auto main(int argc, char **argv) -> int {
         return false;
       }
     }
-    if (!nameFilters.empty()) {
-      std::string subject(path);
-      auto named = std::any_of(
-          nameFilters.begin(), nameFilters.end(), [&](auto const &p) {
-            return wildcardMatch(subject.c_str(), p.c_str());
-          });
-      if (!named) {
-        return false;
-      }
-    }
-    return true;
+    return nameMatcher.empty() || nameMatcher.matches(path);
   };
 
   // Split a query of the form "path[hi:lo]" or "path[bit]" into a base path
@@ -530,19 +681,22 @@ auto main(int argc, char **argv) -> int {
     return {path, DriverBitRange{*hi, *lo}};
   };
 
-  // Human-readable description of a driver node for the --drivers report.
-  auto describeDriver = [](NetlistNode &node) -> std::string {
+  // Human-readable description of a node for the --drivers report and the
+  // paths reported by --queries.
+  auto describeNode = [](NetlistNode const &node) -> std::string {
     switch (node.kind) {
     case NodeKind::Port: {
       auto const &port = node.as<Port>();
       auto const *dir =
           port.isInput() ? "input" : (port.isOutput() ? "output" : "inout");
-      return fmt::format("{} port {}", dir, port.hierarchicalPath);
+      return fmt::format("{} port {}", dir, port.symbol->getHierarchicalPath());
     }
     case NodeKind::Variable:
-      return fmt::format("variable {}", node.as<Variable>().hierarchicalPath);
+      return fmt::format("variable {}",
+                         node.as<Variable>().symbol->getHierarchicalPath());
     case NodeKind::State:
-      return fmt::format("register {}", node.as<State>().hierarchicalPath);
+      return fmt::format("register {}",
+                         node.as<State>().symbol->getHierarchicalPath());
     case NodeKind::Constant:
       return fmt::format("constant {}", node.as<Constant>().value.toString());
     case NodeKind::Assignment:
@@ -598,16 +752,24 @@ auto main(int argc, char **argv) -> int {
       writer.writeValue(bp.phase3_drainSeconds);
       writer.writeProperty("phase4_rvalue_seconds");
       writer.writeValue(bp.phase4_rvalueSeconds);
+      writer.writeProperty("simplify_seconds");
+      writer.writeValue(bp.simplifySeconds);
 
       writer.writeProperty("drain_pending_rvalues_seconds");
       writer.writeValue(bp.drain_pendingRValuesSeconds);
       writer.writeProperty("drain_merges_seconds");
       writer.writeValue(bp.drain_mergesSeconds);
+      writer.writeProperty("link_edges_seconds");
+      writer.writeValue(bp.linkEdgesSeconds);
 
       writer.writeProperty("deferred_block_count");
       writer.writeValue(static_cast<int64_t>(bp.deferredBlockCount));
       writer.writeProperty("deferred_pending_rvalue_count");
       writer.writeValue(static_cast<int64_t>(bp.deferredPendingRValueCount));
+      writer.writeProperty("staged_edge_count");
+      writer.writeValue(static_cast<int64_t>(bp.stagedEdgeCount));
+      writer.writeProperty("contracted_node_count");
+      writer.writeValue(static_cast<int64_t>(bp.contractedNodeCount));
 
       writer.writeProperty("task_min_seconds");
       writer.writeValue(bp.taskMinSeconds);
@@ -623,6 +785,28 @@ auto main(int argc, char **argv) -> int {
       writer.writeValue(static_cast<int64_t>(bp.numThreads));
 
       writer.endObject();
+
+      auto const arena = graphPtr->getArenaStats();
+      writer.writeProperty("arena");
+      writer.startObject();
+      writer.writeProperty("allocations");
+      writer.writeValue(static_cast<int64_t>(arena.allocations));
+      writer.writeProperty("slabs");
+      writer.writeValue(static_cast<int64_t>(arena.slabs));
+      writer.writeProperty("bytes_used");
+      writer.writeValue(static_cast<int64_t>(arena.bytesUsed));
+      writer.writeProperty("bytes_reserved");
+      writer.writeValue(static_cast<int64_t>(arena.bytesReserved));
+      writer.writeProperty("estimated_bytes_saved");
+      writer.writeValue(static_cast<int64_t>(arena.estimatedBytesSaved()));
+      writer.endObject();
+
+      if (auto const *frozen = graphPtr->getFrozen()) {
+        writer.writeProperty("frozen_bytes");
+        writer.writeValue(static_cast<int64_t>(frozen->memoryBytes()));
+        writer.writeProperty("edges_released");
+        writer.writeValue(graphPtr->hasReleasedEdges());
+      }
     }
 
     writer.endObject();
@@ -659,11 +843,14 @@ auto main(int argc, char **argv) -> int {
            {"parallel DFA", fmtTime(bp.phase2_parallelSeconds)},
            {"drain", fmtTime(bp.phase3_drainSeconds)},
            {"resolve R-values", fmtTime(bp.phase4_rvalueSeconds)},
+           {"simplify", fmtTime(bp.simplifySeconds)},
            {"total", fmtTime(bp.totalSeconds())}});
 
       if (bp.deferredBlockCount > 0) {
-        buf.format("\nDFA Tasks ({} blocks, {} pending R-values)\n",
-                   bp.deferredBlockCount, bp.deferredPendingRValueCount);
+        buf.format("\nDFA Tasks ({} blocks, {} pending R-values, {} staged "
+                   "edges)\n",
+                   bp.deferredBlockCount, bp.deferredPendingRValueCount,
+                   bp.stagedEdgeCount);
         Utilities::formatTable(buf, {"Statistic", "Time"},
                                {{"min", fmtTime(bp.taskMinSeconds)},
                                 {"max", fmtTime(bp.taskMaxSeconds)},
@@ -672,6 +859,27 @@ auto main(int argc, char **argv) -> int {
       }
     }
 
+    if (graphPtr) {
+      auto const arena = graphPtr->getArenaStats();
+      auto fmtMB = [](size_t bytes) {
+        return fmt::format("{:.1f} MB",
+                           static_cast<double>(bytes) / (1024.0 * 1024.0));
+      };
+      buf.format("\nGraph Arena ({} allocations, {} slabs)\n",
+                 arena.allocations, arena.slabs);
+      Utilities::formatTable(
+          buf, {"Statistic", "Size"},
+          {{"used", fmtMB(arena.bytesUsed)},
+           {"reserved", fmtMB(arena.bytesReserved)},
+           {"est. malloc overhead saved", fmtMB(arena.estimatedBytesSaved())}});
+      if (auto const *frozen = graphPtr->getFrozen()) {
+        buf.format("\nFrozen snapshot: {} ({} nodes, {} edges{})\n",
+                   fmtMB(frozen->memoryBytes()), frozen->numNodes(),
+                   frozen->numEdges(),
+                   graphPtr->hasReleasedEdges() ? ", edges released" : "");
+      }
+    }
+
     buf.format("\nPeak RSS: {:.1f} MB\n",
                static_cast<double>(peakRSS) / (1024.0 * 1024.0));
     fmt::print(stderr, "{}", buf.str());
@@ -704,6 +912,10 @@ auto main(int argc, char **argv) -> int {
       NetlistSerializer::deserialize(
           std::string_view(fileContent.data(), fileContent.size()), graph);
 
+      if (simplify.value_or(false)) {
+        timePhase("simplify", [&] { graph.contractPassThroughNodes(); });
+      }
+
       DEBUG_PRINT("Loaded netlist has {} nodes and {} edges\n",
                   graph.numNodes(), graph.numEdges());
     } else {
@@ -746,6 +958,7 @@ auto main(int argc, char **argv) -> int {
             .resolveAssignBits = !noResolveAssignBits.value_or(false),
             .propCutsAcrossPorts = !noPropCutsAcrossPorts.value_or(false),
             .numThreads = driver.options.numThreads.value_or(0),
+            .simplify = simplify.value_or(false),
             .blackBoxes = blackBoxes};
         graph.build(*compilation, *analysisManager, opts);
       });
@@ -778,17 +991,230 @@ auto main(int argc, char **argv) -> int {
       fanInName = toPointName;
     }
 
+    // Look up a --fan-out, --fan-in or --from node that may select some of
+    // its bits as "name[hi:lo]" or "name[bit]", in which case only the logic
+    // those bits pass through is traced. A name that is itself a node is
+    // never split.
+    auto lookupBits = [&](std::string const &spec)
+        -> std::pair<NetlistNode *, std::optional<DriverBitRange>> {
+      if (auto *node = graph.lookup(spec)) {
+        return {node, std::nullopt};
+      }
+      auto [path, range] = parseNameAndRange(spec);
+      return {range ? graph.lookup(path) : nullptr, range};
+    };
+
+    // Look up a node by name, or a node and some of its bits, throwing if
+    // there is no such node.
+    auto requireNode = [&](std::string const &name) -> NetlistNode * {
+      auto *node = graph.lookup(name);
+      if (node == nullptr) {
+        SLANG_THROW(
+            std::runtime_error(fmt::format("could not find node: {}", name)));
+      }
+      return node;
+    };
+    auto requireBits = [&](std::string const &name) {
+      auto found = lookupBits(name);
+      if (found.first == nullptr) {
+        SLANG_THROW(
+            std::runtime_error(fmt::format("could not find node: {}", name)));
+      }
+      return found;
+    };
+
+    // Find a path between two nodes, the start optionally selecting some of
+    // its bits, throwing if there is none.
+    auto requirePath = [&](std::string const &fromName,
+                           std::string const &toName,
+                           PathFinder &pathFinder) -> NetlistPath {
+      auto [fromPoint, bits] = requireBits(fromName);
+      auto *toPoint = requireNode(toName);
+      auto path = bits ? pathFinder.find(*fromPoint, *bits, *toPoint)
+                       : pathFinder.find(*fromPoint, *toPoint);
+      if (path.empty()) {
+        SLANG_THROW(std::runtime_error(
+            fmt::format("no path between {} and {}", fromName, toName)));
+      }
+      return path;
+    };
+
+    // The source location of a node, or nothing if it has none.
+    auto locationOf = [&](NetlistNode const &node) -> std::string {
+      auto loc = node.getLocation();
+      return loc ? loc->toString(graph.fileTable) : std::string();
+    };
+
+    // The reports of the queries that can be run one at a time by their own
+    // options or many at once by --queries. They only read the graph, and
+    // each takes the scratch storage it may reuse between calls, so several
+    // threads can run them at once.
+
+    // Report the named nodes of a combinational cone.
+    auto coneReport = [&](std::vector<NetlistNode *> const &cone) {
+      auto report = Report{{"Name", "Location"}, {}};
+      for (auto const *n : cone) {
+        auto path = n->getHierarchicalPath();
+        if (path.has_value() && passesFilters(*path)) {
+          report.table.push_back(
+              Utilities::Row{std::string(*path), locationOf(*n)});
+        }
+      }
+      return report;
+    };
+
+    // Report the nodes of a bit-precise cone with the bits of each reached.
+    auto bitConeReport = [&](std::vector<NetlistGraph::BitNode> const &cone) {
+      auto report = Report{{"Name", "Bits", "Location"}, {}};
+      for (auto const &[n, bits] : cone) {
+        auto path = n->getHierarchicalPath();
+        if (path.has_value() && passesFilters(*path)) {
+          std::string ranges;
+          for (auto const &range : bits) {
+            ranges += (ranges.empty() ? "" : " ") + toString(range);
+          }
+          report.table.push_back(
+              Utilities::Row{std::string(*path), ranges, locationOf(*n)});
+        }
+      }
+      return report;
+    };
+
+    auto fanOutReport = [&](std::string const &name,
+                            TraversalContext &context) {
+      auto [node, bits] = requireBits(name);
+      return bits ? bitConeReport(graph.getCombFanOut(*node, *bits))
+                  : coneReport(graph.getCombFanOut(*node, context));
+    };
+
+    auto fanInReport = [&](std::string const &name, TraversalContext &context) {
+      auto [node, bits] = requireBits(name);
+      return bits ? bitConeReport(graph.getCombFanIn(*node, *bits))
+                  : coneReport(graph.getCombFanIn(*node, context));
+    };
+
+    // Report the nodes found by a pattern.
+    auto findReport = [&](std::vector<NetlistNode *> const &nodes) {
+      auto report = Report{{"Name", "Location"}, {}};
+      for (auto const *node : nodes) {
+        auto path = node->getHierarchicalPath();
+        if (!passesFilters(path.value_or(""))) {
+          continue;
+        }
+        report.table.push_back(Utilities::Row{
+            std::string(path.value_or("(unnamed)")), locationOf(*node)});
+      }
+      return report;
+    };
+
+    // Report the clocks/resets gating a named node. A single hierarchical
+    // name can resolve to several nodes (e.g. a register's State node and
+    // its same-named output Port), so aggregate sensitivity across all of
+    // them and deduplicate.
+    auto sensitivityReport = [&](std::string const &name,
+                                 TraversalContext &context) {
+      auto nodes = graph.findNodes(name);
+      if (nodes.empty()) {
+        SLANG_THROW(
+            std::runtime_error(fmt::format("could not find node: {}", name)));
+      }
+      std::vector<NetlistGraph::SensitivitySource> sensitivity;
+      for (auto *node : nodes) {
+        for (auto const &src : graph.getSensitivity(*node, context)) {
+          if (std::find(sensitivity.begin(), sensitivity.end(), src) ==
+              sensitivity.end()) {
+            sensitivity.push_back(src);
+          }
+        }
+      }
+      auto report = Report{{"Name", "Edge", "Location"}, {}};
+      for (auto const &src : sensitivity) {
+        auto path = src.source->getHierarchicalPath();
+        if (!passesFilters(path.value_or(""))) {
+          continue;
+        }
+        report.table.push_back(
+            Utilities::Row{std::string(path.value_or("(unnamed)")),
+                           std::string(ast::toString(src.edgeKind)),
+                           locationOf(*src.source)});
+      }
+      return report;
+    };
+
+    // Report the constant values driving a named node.
+    auto constantDriversReport = [&](std::string const &name,
+                                     TraversalContext &context) {
+      auto *node = requireNode(name);
+      auto report = Report{{"Value", "Location"}, {}};
+      for (auto const *n : graph.getConstantDrivers(*node, context)) {
+        report.table.push_back(Utilities::Row{
+            n->as<Constant>().value.toString(), locationOf(*n)});
+      }
+      return report;
+    };
+
+    // Report, per bit, the nodes driving a named signal.
+    auto driversReport = [&](std::string const &name) {
+      auto [path, range] = parseNameAndRange(name);
+      requireNode(path);
+      // Without an explicit bit range, report the whole signal.
+      auto drivers =
+          range ? graph.getBitDrivers(path, *range) : graph.getBitDrivers(path);
+      auto report = Report{{"Bits", "Driver", "Location"}, {}};
+      for (auto const &bd : drivers) {
+        report.table.push_back(Utilities::Row{toString(bd.bounds),
+                                              describeNode(*bd.driver),
+                                              locationOf(*bd.driver)});
+      }
+      return report;
+    };
+
+    // Report the nodes of a path from one node to another.
+    auto pathReport = [&](std::string const &fromName,
+                          std::string const &toName, PathFinder &pathFinder) {
+      auto report = Report{{"Node", "Location"}, {}};
+      for (auto const *n : requirePath(fromName, toName, pathFinder)) {
+        report.table.push_back(
+            Utilities::Row{describeNode(*n), locationOf(*n)});
+      }
+      return report;
+    };
+
     if (reportRegisters) {
       auto header = Utilities::Row{"Name", "Location"};
       auto table = Utilities::Table{};
 
-      for (auto const &node : graph.filterNodes(NodeKind::State)) {
-        auto const &stateNode = node->as<State>();
-        if (!passesFilters(stateNode.hierarchicalPath)) {
+      // Scan the node table's columns rather than the nodes themselves. With
+      // --scope or --name filters, only visit the rows of the nodes the
+      // hierarchy trie finds under the scopes (or matching the names).
+      auto const &nodeTable = graph.getNodeTable();
+      auto kinds = nodeTable.getKinds();
+      std::vector<size_t> rows;
+      if (scopeFilters.empty() && nameFilters.empty()) {
+        rows.resize(kinds.size());
+        std::iota(rows.begin(), rows.end(), size_t{0});
+      } else {
+        for (auto const &filter :
+             scopeFilters.empty() ? nameFilters : scopeFilters) {
+          auto nodes = scopeFilters.empty() ? graph.findNodes(filter)
+                                            : graph.findNodesInScope(filter);
+          for (auto *node : nodes) {
+            rows.push_back(node->getGraphIndex());
+          }
+        }
+        std::ranges::sort(rows);
+        rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+      }
+      for (auto i : rows) {
+        if (kinds[i] != NodeKind::State) {
+          continue;
+        }
+        auto path = nodeTable.getSymbol(i)->getHierarchicalPath();
+        if (!passesFilters(path)) {
           continue;
         }
-        auto loc = stateNode.location.toString(graph.fileTable);
-        table.push_back(Utilities::Row{stateNode.hierarchicalPath, loc});
+        auto loc = nodeTable.getLocation(i).toString(graph.fileTable);
+        table.push_back(Utilities::Row{std::move(path), loc});
       }
 
       emitTable(header, table);
@@ -799,7 +1225,10 @@ auto main(int argc, char **argv) -> int {
     // Report combinational loops.
     if (combLoops) {
       CombLoops combLoopsAnalysis(graph);
-      auto cycles = combLoopsAnalysis.getAllLoops();
+      auto const limit =
+          combLoopsLimit.value_or(CombLoops::defaultLoopsPerComponent);
+      std::vector<std::vector<const NetlistNode *>> truncated;
+      auto cycles = combLoopsAnalysis.getAllLoops(limit, &truncated);
       if (cycles.empty()) {
         OS::print("No combinational loops detected in the design.\n");
       } else {
@@ -809,48 +1238,227 @@ auto main(int argc, char **argv) -> int {
           OS::print(fmt::format("{}\n", result));
         }
       }
+      if (!truncated.empty()) {
+        OS::print(fmt::format(
+            "Note: listed only the first {} loop(s) of {} component(s); use "
+            "--comb-loops-limit 0 to list them all.\n",
+            limit, truncated.size()));
+      }
+      printStats();
+      return 0;
+    }
+
+    // Report the endpoints with the deepest combinational logic in front of
+    // them, and a path through that logic to each.
+    if (logicDepth) {
+      LogicLevels levels(graph);
+      size_t reported = 0;
+      for (auto *node : levels.getEndpointsByDepth()) {
+        auto depth = levels.getDepth(*node);
+        if (depth == 0 || (*logicDepth != 0 && reported == *logicDepth)) {
+          break;
+        }
+        auto path = node->getHierarchicalPath().value_or("");
+        if (!passesFilters(path)) {
+          continue;
+        }
+        OS::print(fmt::format("Logic depth {}: {}\n\n", depth, path));
+        auto result = reportPath(graph.fileTable, diagnostics.get(),
+                                 levels.getDeepestPath(*node));
+        OS::print(fmt::format("{}\n", result));
+        reported++;
+      }
+      if (reported == 0) {
+        OS::print("No combinational logic in front of any endpoint.\n");
+      }
+      printStats();
+      return 0;
+    }
+
+    // The remaining commands are read-only queries, so run them over a
+    // compact snapshot of the graph.
+
+    // Run a batch of queries from a file.
+    if (queriesFile) {
+      SmallVector<char> fileContent;
+      if (OS::readFile(*queriesFile, fileContent)) {
+        SLANG_THROW(std::runtime_error(
+            fmt::format("could not read file: {}", *queriesFile)));
+      }
+
+      // The queries, one to a line, skipping blank lines and comments.
+      struct Query {
+        size_t line;
+        std::string text;
+        std::vector<std::string> words;
+      };
+      std::vector<Query> queries;
+      std::string_view content(fileContent.data(), fileContent.size());
+      for (size_t line = 1; !content.empty(); line++) {
+        auto end = std::min(content.find('\n'), content.size());
+        auto text = content.substr(0, end);
+        content.remove_prefix(std::min(end + 1, content.size()));
+        if (text.ends_with('\r')) {
+          text.remove_suffix(1);
+        }
+        auto words = splitWords(text);
+        if (!words.empty() && !words[0].starts_with('#')) {
+          queries.push_back({line, std::string(text), std::move(words)});
+        }
+      }
+
+      // Path queries and the fan-out or fan-in of selected bits walk the
+      // graph's own edges. Without any, the snapshot stands in for the edges
+      // and they are released for the batch.
+      auto needsEdges = [&](Query const &query) {
+        auto command = std::string_view(query.words[0]);
+        if (command.starts_with("--")) {
+          command.remove_prefix(2);
+        }
+        if (command == "path") {
+          return true;
+        }
+        return (command == "fan-out" || command == "fan-in") &&
+               query.words.size() > 1 &&
+               parseNameAndRange(query.words[1]).second.has_value();
+      };
+      graph.freeze(
+          /*releaseEdges=*/std::ranges::none_of(queries, needsEdges));
+
+      // Build the lookup indexes up front rather than have the first task
+      // to need each build it while the others wait.
+      timePhase("indexes", [&] { graph.buildIndexes(); });
+
+      // Run a query and return its result as a line of JSON: the query and
+      // the rows of its report, or the error it failed with.
+      auto runQuery = [&](Query const &query, TraversalContext &context,
+                          PathFinder &pathFinder) {
+        JsonWriter writer;
+        writer.startObject();
+        writer.writeProperty("line");
+        writer.writeValue(static_cast<int64_t>(query.line));
+        writer.writeProperty("query");
+        writer.writeValue(query.text);
+        SLANG_TRY {
+          auto const &words = query.words;
+          auto command = std::string_view(words[0]);
+          if (command.starts_with("--")) {
+            command.remove_prefix(2);
+          }
+          auto const numArgs = command == "path" ? size_t{2} : size_t{1};
+          if (words.size() != numArgs + 1) {
+            SLANG_THROW(std::runtime_error(
+                fmt::format("expected {} argument{} to {}", numArgs,
+                            numArgs == 1 ? "" : "s", command)));
+          }
+          Report report;
+          if (command == "fan-out") {
+            report = fanOutReport(words[1], context);
+          } else if (command == "fan-in") {
+            report = fanInReport(words[1], context);
+          } else if (command == "find") {
+            report = findReport(graph.findNodes(words[1]));
+          } else if (command == "find-regex") {
+            // Queries already run on the batch pool, so match serially.
+            report = findReport(
+                graph.findNodesRegex(words[1], /*parallel=*/false));
+          } else if (command == "sensitivity") {
+            report = sensitivityReport(words[1], context);
+          } else if (command == "constant-drivers") {
+            report = constantDriversReport(words[1], context);
+          } else if (command == "drivers") {
+            report = driversReport(words[1]);
+          } else if (command == "path") {
+            report = pathReport(words[1], words[2], pathFinder);
+          } else {
+            SLANG_THROW(std::runtime_error(
+                fmt::format("unknown query '{}'", command)));
+          }
+          writer.writeProperty("results");
+          writeJsonRows(writer, report.header, report.table);
+        }
+        SLANG_CATCH(const std::exception &e) {
+          writer.writeProperty("error");
+          writer.writeValue(std::string_view(e.what()));
+        }
+        writer.endObject();
+        return fmt::format("{}\n", writer.view());
+      };
+
+      // Blocks of queries are run in parallel over the frozen graph, each
+      // block reusing one set of scratch storage, and the results are
+      // written in the order of the file.
+      constexpr size_t queriesPerTask = 16;
+      std::vector<std::string> results(queries.size());
+      auto runBlock = [&](size_t block) {
+        TraversalContext context;
+        PathFinder pathFinder(pathMode);
+        auto end = std::min(queries.size(), (block + 1) * queriesPerTask);
+        for (auto i = block * queriesPerTask; i < end; i++) {
+          results[i] = runQuery(queries[i], context, pathFinder);
+        }
+      };
+      timePhase("queries", [&] {
+        auto const numBlocks =
+            (queries.size() + queriesPerTask - 1) / queriesPerTask;
+        auto const numThreads = driver.options.numThreads.value_or(0);
+        if (numBlocks <= 1 || numThreads == 1) {
+          for (size_t block = 0; block < numBlocks; block++) {
+            runBlock(block);
+          }
+        } else {
+          BS::thread_pool<> threadPool(numThreads);
+          threadPool.detach_loop(size_t{0}, numBlocks, runBlock);
+          threadPool.wait();
+        }
+      });
+
+      std::string output;
+      for (auto const &result : results) {
+        output += result;
+      }
+      writeOutput(output);
       printStats();
       return 0;
     }
 
+    graph.freeze();
+
     // Output a DOT file of the netlist. When combined with a fan-out, fan-in
     // or path selector, render only that induced subgraph instead of the
     // whole netlist.
     if (netlistDotFile) {
-      auto requireNode = [&](std::string const &name) -> NetlistNode * {
-        auto *node = graph.lookup(name);
-        if (node == nullptr) {
-          SLANG_THROW(
-              std::runtime_error(fmt::format("could not find node: {}", name)));
-        }
-        return node;
-      };
-
       netlist::FormatBuffer buffer;
       if (fanOutName || fanInName || (fromPointName && toPointName)) {
         std::unordered_set<NetlistNode const *> scope;
         if (fanOutName) {
-          auto *node = requireNode(*fanOutName);
+          auto [node, bits] = requireBits(*fanOutName);
           scope.insert(node);
-          for (auto *n : graph.getCombFanOut(*node)) {
-            scope.insert(n);
+          if (bits) {
+            for (auto const &n : graph.getCombFanOut(*node, *bits)) {
+              scope.insert(n.node);
+            }
+          } else {
+            for (auto *n : graph.getCombFanOut(*node)) {
+              scope.insert(n);
+            }
           }
         } else if (fanInName) {
-          auto *node = requireNode(*fanInName);
+          auto [node, bits] = requireBits(*fanInName);
           scope.insert(node);
-          for (auto *n : graph.getCombFanIn(*node)) {
-            scope.insert(n);
+          if (bits) {
+            for (auto const &n : graph.getCombFanIn(*node, *bits)) {
+              scope.insert(n.node);
+            }
+          } else {
+            for (auto *n : graph.getCombFanIn(*node)) {
+              scope.insert(n);
+            }
           }
         } else {
-          auto *fromPoint = requireNode(*fromPointName);
-          auto *toPoint = requireNode(*toPointName);
-          PathFinder pathFinder;
-          auto path = pathFinder.find(*fromPoint, *toPoint);
-          if (path.empty()) {
-            SLANG_THROW(std::runtime_error(fmt::format(
-                "no path between {} and {}", *fromPointName, *toPointName)));
-          }
-          for (auto const *n : path) {
+          PathFinder pathFinder(pathMode);
+          for (auto const *n :
+               requirePath(*fromPointName, *toPointName, pathFinder)) {
             scope.insert(n);
           }
         }
@@ -865,159 +1473,60 @@ auto main(int argc, char **argv) -> int {
 
     // Find named nodes by wildcard or regex pattern.
     if (findPattern.has_value() || findRegexPattern.has_value()) {
-      auto nodes = findPattern.has_value()
-                       ? graph.findNodes(*findPattern)
-                       : graph.findNodesRegex(*findRegexPattern);
-      auto header = Utilities::Row{"Name", "Location"};
-      auto table = Utilities::Table{};
-      for (auto const *node : nodes) {
-        auto path = node->getHierarchicalPath();
-        if (!passesFilters(path.value_or(""))) {
-          continue;
-        }
-        auto loc = node->getLocation();
-        table.push_back(Utilities::Row{std::string(path.value_or("(unnamed)")),
-                                       loc ? loc->toString(graph.fileTable)
-                                           : std::string()});
-      }
-      emitTable(header, table);
+      auto report = findReport(findPattern.has_value()
+                                   ? graph.findNodes(*findPattern)
+                                   : graph.findNodesRegex(*findRegexPattern));
+      emitTable(report.header, report.table);
       printStats();
       return 0;
     }
 
+    // Scratch storage for the traversals of the queries below.
+    TraversalContext context;
+
     // Report combinational fan-out from a named node.
     if (fanOutName.has_value()) {
-      auto *node = graph.lookup(*fanOutName);
-      if (node == nullptr) {
-        SLANG_THROW(std::runtime_error(
-            fmt::format("could not find node: {}", *fanOutName)));
-      }
-      auto fanOut = graph.getCombFanOut(*node);
-      auto header = Utilities::Row{"Name", "Location"};
-      auto table = Utilities::Table{};
-      for (auto const *n : fanOut) {
-        auto path = n->getHierarchicalPath();
-        if (path.has_value() && passesFilters(*path)) {
-          auto loc = n->getLocation();
-          table.push_back(Utilities::Row{std::string(*path),
-                                         loc ? loc->toString(graph.fileTable)
-                                             : std::string()});
-        }
-      }
-      emitTable(header, table);
+      auto report = fanOutReport(*fanOutName, context);
+      emitTable(report.header, report.table);
       printStats();
       return 0;
     }
 
     // Report combinational fan-in to a named node.
     if (fanInName.has_value()) {
-      auto *node = graph.lookup(*fanInName);
-      if (node == nullptr) {
-        SLANG_THROW(std::runtime_error(
-            fmt::format("could not find node: {}", *fanInName)));
-      }
-      auto fanIn = graph.getCombFanIn(*node);
-      auto header = Utilities::Row{"Name", "Location"};
-      auto table = Utilities::Table{};
-      for (auto const *n : fanIn) {
-        auto path = n->getHierarchicalPath();
-        if (path.has_value() && passesFilters(*path)) {
-          auto loc = n->getLocation();
-          table.push_back(Utilities::Row{std::string(*path),
-                                         loc ? loc->toString(graph.fileTable)
-                                             : std::string()});
-        }
-      }
-      emitTable(header, table);
+      auto report = fanInReport(*fanInName, context);
+      emitTable(report.header, report.table);
       printStats();
       return 0;
     }
 
-    // Report the clocks/resets gating a named node. A single hierarchical
-    // name can resolve to several nodes (e.g. a register's State node and
-    // its same-named output Port), so aggregate sensitivity across all of
-    // them and deduplicate.
+    // Report the clocks/resets gating a named node.
     if (sensitivityName.has_value()) {
-      auto nodes = graph.findNodes(*sensitivityName);
-      if (nodes.empty()) {
-        SLANG_THROW(std::runtime_error(
-            fmt::format("could not find node: {}", *sensitivityName)));
-      }
-      std::vector<NetlistGraph::SensitivitySource> sensitivity;
-      for (auto *node : nodes) {
-        for (auto const &src : graph.getSensitivity(*node)) {
-          if (std::find(sensitivity.begin(), sensitivity.end(), src) ==
-              sensitivity.end()) {
-            sensitivity.push_back(src);
-          }
-        }
-      }
-      auto header = Utilities::Row{"Name", "Edge", "Location"};
-      auto table = Utilities::Table{};
-      for (auto const &src : sensitivity) {
-        auto path = src.source->getHierarchicalPath();
-        if (!passesFilters(path.value_or(""))) {
-          continue;
-        }
-        auto loc = src.source->getLocation();
-        table.push_back(Utilities::Row{std::string(path.value_or("(unnamed)")),
-                                       std::string(ast::toString(src.edgeKind)),
-                                       loc ? loc->toString(graph.fileTable)
-                                           : std::string()});
-      }
-      emitTable(header, table);
+      auto report = sensitivityReport(*sensitivityName, context);
+      emitTable(report.header, report.table);
       printStats();
       return 0;
     }
 
     // Report the constant values driving a named node.
     if (constantDriversName.has_value()) {
-      auto *node = graph.lookup(*constantDriversName);
-      if (node == nullptr) {
-        SLANG_THROW(std::runtime_error(
-            fmt::format("could not find node: {}", *constantDriversName)));
-      }
-      auto constants = graph.getConstantDrivers(*node);
-      auto header = Utilities::Row{"Value", "Location"};
-      auto table = Utilities::Table{};
-      for (auto const *n : constants) {
-        auto const &constant = n->as<Constant>();
-        auto loc = constant.getLocation();
-        table.push_back(Utilities::Row{constant.value.toString(),
-                                       loc ? loc->toString(graph.fileTable)
-                                           : std::string()});
-      }
-      emitTable(header, table);
+      auto report = constantDriversReport(*constantDriversName, context);
+      emitTable(report.header, report.table);
       printStats();
       return 0;
     }
 
     // Report, per bit, the nodes driving a named signal.
     if (driversName.has_value()) {
-      auto [path, range] = parseNameAndRange(*driversName);
-      if (graph.lookup(path) == nullptr) {
-        SLANG_THROW(
-            std::runtime_error(fmt::format("could not find node: {}", path)));
-      }
-      // Without an explicit bit range, report the whole signal.
-      auto drivers =
-          range ? graph.getBitDrivers(path, *range) : graph.getBitDrivers(path);
-      auto header = Utilities::Row{"Bits", "Driver", "Location"};
-      auto table = Utilities::Table{};
-      for (auto const &bd : drivers) {
-        auto loc = bd.driver->getLocation();
-        table.push_back(Utilities::Row{
-            toString(bd.bounds), describeDriver(*bd.driver),
-            loc ? loc->toString(graph.fileTable) : std::string()});
-      }
-      emitTable(header, table);
+      auto report = driversReport(*driversName);
+      emitTable(report.header, report.table);
       printStats();
       return 0;
     }
 
     // Find a point-to-point path in the netlist.
     if (fromPointName.has_value() && toPointName.has_value()) {
-      auto *fromPoint = graph.lookup(*fromPointName);
+      auto [fromPoint, fromBits] = lookupBits(*fromPointName);
       if (fromPoint == nullptr) {
         SLANG_THROW(std::runtime_error(
             fmt::format("could not find start point: {}", *fromPointName)));
@@ -1031,9 +1540,33 @@ auto main(int argc, char **argv) -> int {
       DEBUG_PRINT("Searching for path between: {} and {}\n", *fromPointName,
                   *toPointName);
 
-      // Search for the path.
-      PathFinder pathFinder;
-      auto path = pathFinder.find(*fromPoint, *toPoint);
+      // Report several paths, found one at a time.
+      if (maxPaths) {
+        PathEnumerator paths(
+            *fromPoint, *toPoint,
+            PathLimits{*maxPaths, maxPathDepth.value_or(0),
+                       std::chrono::milliseconds(pathTimeLimit.value_or(0))});
+        while (auto path = paths.next()) {
+          auto result = reportPath(graph.fileTable, diagnostics.get(), *path);
+          OS::print(fmt::format("{}\n", result));
+        }
+        if (paths.getStatus() == PathEnumerator::Status::TimeLimit) {
+          fmt::print(stderr, "warning: path search stopped after {} ms\n",
+                     *pathTimeLimit);
+        }
+        if (paths.numPaths() != 0) {
+          printStats();
+          return 0;
+        }
+        SLANG_THROW(std::runtime_error(fmt::format(
+            "no path between {} and {}", *fromPointName, *toPointName)));
+      }
+
+      // Search for the path, through only the logic the selected bits of
+      // the start pass through if there are any.
+      PathFinder pathFinder(pathMode);
+      auto path = fromBits ? pathFinder.find(*fromPoint, *fromBits, *toPoint)
+                           : pathFinder.find(*fromPoint, *toPoint);
 
       if (!path.empty()) {
         auto result = reportPath(graph.fileTable, diagnostics.get(), path);
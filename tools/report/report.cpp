@@ -52,13 +52,13 @@ auto hasGlobChar(std::string_view s) -> bool {
 /// Recursively walk @p scope, appending every member whose hierarchical
 /// path matches @p pattern (deduped by symbol identity, preserving AST
 /// traversal order).
-void collectGlobMatches(const ast::Scope &scope, std::string const &pattern,
+void collectGlobMatches(const ast::Scope &scope,
+                        netlist::WildcardSet const &pattern,
                         std::unordered_set<const ast::Symbol *> &seen,
                         std::vector<const ast::Symbol *> &out) {
   for (auto const &member : scope.members()) {
     auto path = member.getHierarchicalPath();
-    if (!path.empty() &&
-        netlist::wildcardMatch(path.c_str(), pattern.c_str())) {
+    if (!path.empty() && pattern.matches(path)) {
       if (seen.insert(&member).second) {
         out.push_back(&member);
       }
@@ -181,7 +181,9 @@ auto main(int argc, char **argv) -> int {
     for (auto const &scopeName : scopes) {
       if (hasGlobChar(scopeName)) {
         auto const before = scopeSymbols.size();
-        collectGlobMatches(compilation->getRoot(), scopeName, seenSymbols,
+        netlist::WildcardSet pattern;
+        pattern.add(scopeName);
+        collectGlobMatches(compilation->getRoot(), pattern, seenSymbols,
                            scopeSymbols);
         if (scopeSymbols.size() == before) {
           SLANG_THROW(std::runtime_error(